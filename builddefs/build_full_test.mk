@@ -13,6 +13,9 @@
 # You should have received a copy of the GNU General Public License
 # along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+ifeq ($(strip $(SIMULATOR)), yes)
+include $(PLATFORM_PATH)/$(PLATFORM_KEY)/simulator/simulator.mk
+else
 $(TEST)_INC := \
 	tests/test_common/common_config.h
 
@@ -26,11 +29,16 @@ $(TEST)_SRC := \
 	tests/test_common/keyboard_report_util.cpp \
 	tests/test_common/test_fixture.cpp \
 	tests/test_common/test_keymap_key.cpp \
+	tests/test_common/test_latency.cpp \
 	tests/test_common/test_logger.cpp \
+	tests/test_common/test_metrics.cpp \
+	tests/test_common/test_replay.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/simulator/sim_trace_parse.c \
 	$(patsubst $(ROOTDIR)/%,%,$(wildcard $(TEST_PATH)/*.cpp))
 
 $(TEST)_DEFS := $(TMK_COMMON_DEFS) $(OPT_DEFS)
 
 $(TEST)_CONFIG := $(TEST_PATH)/config.h
 
-VPATH += $(TOP_DIR)/tests/test_common
+VPATH += $(TOP_DIR)/tests/test_common $(PLATFORM_PATH)/$(PLATFORM_KEY)/simulator
+endif
@@ -15,6 +15,11 @@
 #include "spi_master.h"
 #include "progmem.h"
 
+#ifdef PMW33XX_MOTION_INTERRUPT
+#    include <ch.h>
+#    include <hal.h>
+#endif
+
 extern const uint8_t pmw33xx_firmware_data[PMW33XX_FIRMWARE_LENGTH] PROGMEM;
 extern const uint8_t pmw33xx_firmware_signature[3] PROGMEM;
 
@@ -23,8 +28,38 @@ static bool        in_burst[sizeof(cs_pins) / sizeof(pin_t)] = {0};
 
 const size_t pmw33xx_number_of_sensors = sizeof(cs_pins) / sizeof(pin_t);
 
+#ifdef PMW33XX_MOTION_INTERRUPT
+/*
+ * The motion thread and the main loop both talk to the sensors, the lock
+ * keeps their SPI transactions apart. Starting a transaction while already
+ * holding the lock fails just like spi_start() does, and releases it again.
+ */
+static MUTEX_DECL(spi_mutex);
+static thread_t *spi_owner = NULL;
+
+static void pmw33xx_spi_lock(void) {
+    if (spi_owner != chThdGetSelfX()) {
+        chMtxLock(&spi_mutex);
+        spi_owner = chThdGetSelfX();
+    }
+}
+
+static void pmw33xx_spi_unlock(void) {
+    if (spi_owner == chThdGetSelfX()) {
+        spi_owner = NULL;
+        chMtxUnlock(&spi_mutex);
+    }
+}
+#else
+static inline void pmw33xx_spi_lock(void) {}
+static inline void pmw33xx_spi_unlock(void) {}
+#endif
+
 bool __attribute__((cold)) pmw33xx_upload_firmware(uint8_t sensor);
 bool __attribute__((cold)) pmw33xx_check_signature(uint8_t sensor);
+#ifdef PMW33XX_MOTION_INTERRUPT
+static void pmw33xx_motion_interrupt_init(uint8_t sensor);
+#endif
 
 void pmw33xx_set_cpi_all_sensors(uint16_t cpi) {
     for (uint8_t sensor = 0; sensor < pmw33xx_number_of_sensors; sensor++) {
@@ -32,9 +67,15 @@ void pmw33xx_set_cpi_all_sensors(uint16_t cpi) {
     }
 }
 
+static void pmw33xx_spi_stop(void) {
+    spi_stop();
+    pmw33xx_spi_unlock();
+}
+
 bool pmw33xx_spi_start(uint8_t sensor) {
+    pmw33xx_spi_lock();
     if (!spi_start(cs_pins[sensor], false, 3, PMW33XX_SPI_DIVISOR)) {
-        spi_stop();
+        pmw33xx_spi_stop();
         return false;
     }
     // tNCS-SCLK, 10ns
@@ -54,12 +95,13 @@ bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
     // send address of the register, with MSBit = 1 to indicate it's a write
     uint8_t command[2] = {reg_addr | 0x80, data};
     if (spi_transmit(command, sizeof(command)) != SPI_STATUS_SUCCESS) {
+        pmw33xx_spi_stop();
         return false;
     }
 
     // tSCLK-NCS for write operation is 35us
     wait_us(35);
-    spi_stop();
+    pmw33xx_spi_stop();
 
     // tSWW/tSWR (=18us) minus tSCLK-NCS. Could be shortened, but it looks like
     // a safe lower bound
@@ -80,7 +122,7 @@ uint8_t pmw33xx_read(uint8_t sensor, uint8_t reg_addr) {
 
     // tSCLK-NCS, 120ns
     wait_us(1);
-    spi_stop();
+    pmw33xx_spi_stop();
 
     //  tSRW/tSRR (=20us) mins tSCLK-NCS
     wait_us(19);
@@ -138,7 +180,7 @@ bool pmw33xx_init(uint8_t sensor) {
         return false;
     }
     wait_us(40);
-    spi_stop();
+    pmw33xx_spi_stop();
     wait_us(40);
 
     if (!pmw33xx_write(sensor, REG_Power_Up_Reset, 0x5a)) {
@@ -158,7 +200,7 @@ bool pmw33xx_init(uint8_t sensor) {
         return false;
     }
 
-    spi_stop();
+    pmw33xx_spi_stop();
 
     wait_ms(10);
     pmw33xx_set_cpi(sensor, PMW33XX_CPI);
@@ -174,18 +216,18 @@ bool pmw33xx_init(uint8_t sensor) {
         return false;
     }
 
+#ifdef PMW33XX_MOTION_INTERRUPT
+    pmw33xx_motion_interrupt_init(sensor);
+#endif
+
     return true;
 }
 
-pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
+/* Reads a motion burst without any console output, the console is not safe to use from the motion thread */
+static pmw33xx_report_t pmw33xx_read_burst_quiet(uint8_t sensor) {
     pmw33xx_report_t report = {0};
 
-    if (sensor >= pmw33xx_number_of_sensors) {
-        return report;
-    }
-
     if (!in_burst[sensor]) {
-        dprintf("PMW33XX (%d): burst\n", sensor);
         if (!pmw33xx_write(sensor, REG_Motion_Burst, 0x00)) {
             return report;
         }
@@ -206,14 +248,152 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
         in_burst[sensor] = false;
     }
 
-    spi_stop();
+    pmw33xx_spi_stop();
+
+    report.delta_x *= -1;
+    report.delta_y *= -1;
+
+    return report;
+}
+
+pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
+    if (sensor >= pmw33xx_number_of_sensors) {
+        return (pmw33xx_report_t){0};
+    }
+
+    if (!in_burst[sensor]) {
+        dprintf("PMW33XX (%d): burst\n", sensor);
+    }
+
+    pmw33xx_report_t report = pmw33xx_read_burst_quiet(sensor);
 
     if (debug_config.mouse) {
-        dprintf("PMW33XX (%d): motion: 0x%x dx: %i dy: %i\n", sensor, report.motion.w, report.delta_x, report.delta_y);
+        dprintf("PMW33XX (%d): motion: 0x%x dx: %i dy: %i\n", sensor, report.motion.w, -report.delta_x, -report.delta_y);
     }
 
-    report.delta_x *= -1;
-    report.delta_y *= -1;
+    return report;
+}
+
+#ifdef PMW33XX_MOTION_INTERRUPT
+/*
+ * The sensors assert their motion pin as soon as they have motion to report,
+ * and release it once the motion registers have been read. A high priority
+ * thread woken by the pin burst reads the sensor right away and adds the
+ * deltas onto running totals, which the main loop takes the difference of
+ * whenever it builds a report. Nothing is polled while there is no motion,
+ * and no counts are lost to a busy main loop.
+ */
+typedef struct {
+    volatile uint16_t sequence; // odd while the totals are being updated
+    volatile uint32_t x;
+    volatile uint32_t y;
+    volatile bool     is_lifted;
+} pmw33xx_accumulator_t;
+
+static const pin_t           motion_pins[] = PMW33XX_MOTION_PINS;
+static pmw33xx_accumulator_t accumulators[sizeof(cs_pins) / sizeof(pin_t)];
+static struct {
+    uint32_t x;
+    uint32_t y;
+} consumed[sizeof(cs_pins) / sizeof(pin_t)];
+static BSEMAPHORE_DECL(motion_pending, true);
+
+_Static_assert(sizeof(motion_pins) == sizeof(cs_pins), "PMW33XX_MOTION_PINS needs one pin per sensor in PMW33XX_CS_PINS");
+
+static void pmw33xx_motion_callback(void *arg) {
+    (void)arg;
+    chSysLockFromISR();
+    chBSemSignalI(&motion_pending);
+    chSysUnlockFromISR();
+}
+
+static void pmw33xx_accumulate(uint8_t sensor) {
+    pmw33xx_report_t       report      = pmw33xx_read_burst_quiet(sensor);
+    pmw33xx_accumulator_t *accumulator = &accumulators[sensor];
+
+    accumulator->is_lifted = report.motion.b.is_lifted;
+    if (report.motion.b.is_lifted || !report.motion.b.is_motion) {
+        return;
+    }
+
+    accumulator->sequence++;
+    accumulator->x += (uint32_t)(int32_t)report.delta_x;
+    accumulator->y += (uint32_t)(int32_t)report.delta_y;
+    accumulator->sequence++;
+}
+
+static THD_WORKING_AREA(pmw33xx_motion_thread_wa, PMW33XX_MOTION_STACK_SIZE);
+static THD_FUNCTION(pmw33xx_motion_thread, arg) {
+    (void)arg;
+    chRegSetThreadName("pmw33xx_motion");
+
+    while (true) {
+        chBSemWait(&motion_pending);
+
+        // Keep reading for as long as the sensors have more motion to report
+        bool asserted;
+        do {
+            asserted = false;
+            for (uint8_t sensor = 0; sensor < pmw33xx_number_of_sensors; sensor++) {
+                if (!readPin(motion_pins[sensor])) {
+                    pmw33xx_accumulate(sensor);
+                    asserted = true;
+                }
+            }
+            if (asserted) {
+                chThdSleepMicroseconds(PMW33XX_MOTION_INTERVAL_US);
+            }
+        } while (asserted);
+    }
+}
+
+static void pmw33xx_motion_interrupt_init(uint8_t sensor) {
+    static thread_t *motion_thread = NULL;
+
+    setPinInputHigh(motion_pins[sensor]);
+    palEnableLineEvent(motion_pins[sensor], PAL_EVENT_MODE_FALLING_EDGE);
+    palSetLineCallback(motion_pins[sensor], pmw33xx_motion_callback, NULL);
+
+    if (motion_thread == NULL) {
+        motion_thread = chThdCreateStatic(pmw33xx_motion_thread_wa, sizeof(pmw33xx_motion_thread_wa), HIGHPRIO, pmw33xx_motion_thread, NULL);
+    }
+
+    // Catch up on motion from before the interrupt was enabled
+    chBSemSignal(&motion_pending);
+}
+
+static int16_t pmw33xx_take(uint32_t total, uint32_t *consumed, int16_t limit) {
+    int32_t delta = (int32_t)(total - *consumed);
+    if (delta > limit) {
+        delta = limit;
+    } else if (delta < -limit) {
+        delta = -limit;
+    }
+    *consumed += (uint32_t)delta;
+    return delta;
+}
+
+pmw33xx_report_t pmw33xx_read_accumulated(uint8_t sensor, int16_t limit) {
+    pmw33xx_report_t report = {0};
+
+    if (sensor >= pmw33xx_number_of_sensors) {
+        return report;
+    }
+
+    pmw33xx_accumulator_t *accumulator = &accumulators[sensor];
+    uint16_t               sequence;
+    uint32_t               x, y;
+    do {
+        sequence = accumulator->sequence;
+        x        = accumulator->x;
+        y        = accumulator->y;
+    } while ((sequence & 1) || sequence != accumulator->sequence);
+
+    report.delta_x            = pmw33xx_take(x, &consumed[sensor].x, limit);
+    report.delta_y            = pmw33xx_take(y, &consumed[sensor].y, limit);
+    report.motion.b.is_motion = report.delta_x != 0 || report.delta_y != 0;
+    report.motion.b.is_lifted = accumulator->is_lifted && !report.motion.b.is_motion;
 
     return report;
 }
+#endif
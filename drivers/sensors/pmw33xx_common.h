@@ -79,6 +79,31 @@ _Static_assert(sizeof((pmw33xx_report_t){0}.motion) == 1, "pmw33xx_report_t.moti
 #    endif
 #endif
 
+#if defined(PMW33XX_MOTION_INTERRUPT)
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error "PMW33XX_MOTION_INTERRUPT is only supported on ChibiOS"
+#    endif
+#    if defined(POINTING_DEVICE_MOTION_PIN)
+#        error "PMW33XX_MOTION_INTERRUPT services the motion pin itself, define PMW33XX_MOTION_PIN instead of POINTING_DEVICE_MOTION_PIN"
+#    endif
+#    ifndef PMW33XX_MOTION_PINS
+#        ifdef PMW33XX_MOTION_PIN
+#            define PMW33XX_MOTION_PINS \
+                { PMW33XX_MOTION_PIN }
+#        else
+#            error "No motion pin defined -- missing PMW33XX_MOTION_PIN or PMW33XX_MOTION_PINS"
+#        endif
+#    endif
+// Time between burst reads while the motion pin stays asserted
+#    ifndef PMW33XX_MOTION_INTERVAL_US
+#        define PMW33XX_MOTION_INTERVAL_US 250
+#    endif
+// Stack of the burst read thread, which runs the SPI transfers and the driver's debug output
+#    ifndef PMW33XX_MOTION_STACK_SIZE
+#        define PMW33XX_MOTION_STACK_SIZE 512
+#    endif
+#endif
+
 #if PMW33XX_CPI > PMW33XX_CPI_MAX || PMW33XX_CPI < PMW33XX_CPI_MIN || (PMW33XX_CPI % PMW33XX_CPI_STEP) != 0U
 #    pragma message "PMW33XX_CPI has to be in the range of " STR(PMW33XX_CPI_MAX) "-" STR(PMW33XX_CPI_MIN) " in increments of " STR(PMW33XX_CPI_STEP) ". But it is " STR(PMW33XX_CPI) "."
 #    error Use correct PMW33XX_CPI value.
@@ -135,6 +160,18 @@ void pmw33xx_set_cpi_all_sensors(uint16_t cpi);
  */
 pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor);
 
+/**
+ * @brief Takes the deltas accumulated by the motion interrupt since the last
+ * call. At most limit counts are taken per axis, anything beyond that is kept
+ * for the next call. Only available with PMW33XX_MOTION_INTERRUPT.
+ *
+ * @param sensor Index of the sensors chip select pin
+ * @param limit Largest magnitude of the returned deltas
+ * @return pmw33xx_report_t Accumulated deltas, with is_motion set if they are
+ * non-zero
+ */
+pmw33xx_report_t pmw33xx_read_accumulated(uint8_t sensor, int16_t limit);
+
 /**
  * @brief Read one byte of data from the given register on the sensor
  *
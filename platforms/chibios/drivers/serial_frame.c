@@ -0,0 +1,85 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "serial_frame.h"
+#include "serial_protocol.h"
+
+static uint16_t receive_crc;
+
+uint16_t serial_ring_available(const serial_ring_t* ring, uint16_t head) {
+    return (uint16_t)(head + ring->size - ring->tail) % ring->size;
+}
+
+uint16_t serial_ring_read(serial_ring_t* ring, uint16_t head, uint8_t* destination, uint16_t size) {
+    uint16_t available = serial_ring_available(ring, head);
+    if (size > available) {
+        size = available;
+    }
+
+    for (uint16_t i = 0; i < size; i++) {
+        destination[i] = ring->buffer[ring->tail];
+        if (++ring->tail == ring->size) {
+            ring->tail = 0;
+        }
+    }
+
+    return size;
+}
+
+uint16_t serial_frame_crc16(uint16_t crc, const uint8_t* data, size_t size) {
+    while (size--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (uint8_t i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+bool serial_frame_send(uint8_t id, const uint8_t* payload, size_t size) {
+    uint8_t  header[2] = {SERIAL_FRAME_START, id};
+    uint16_t crc       = serial_frame_crc16(SERIAL_FRAME_CRC16_INIT, &id, sizeof(id));
+    crc                = serial_frame_crc16(crc, payload, size);
+    uint8_t trailer[2] = {crc & 0xFF, crc >> 8};
+
+    if (!serial_transport_send(header, sizeof(header))) {
+        return false;
+    }
+    if (size && !serial_transport_send(payload, size)) {
+        return false;
+    }
+    return serial_transport_send(trailer, sizeof(trailer));
+}
+
+bool serial_frame_receive_header(uint8_t* id, bool blocking) {
+    uint8_t start;
+
+    /* Skip over what is left of corrupted or truncated frames. */
+    do {
+        bool success = blocking ? serial_transport_receive_blocking(&start, sizeof(start)) : serial_transport_receive(&start, sizeof(start));
+        if (!success || (!blocking && start != SERIAL_FRAME_START)) {
+            return false;
+        }
+    } while (start != SERIAL_FRAME_START);
+
+    if (!serial_transport_receive(id, sizeof(*id))) {
+        return false;
+    }
+
+    receive_crc = serial_frame_crc16(SERIAL_FRAME_CRC16_INIT, id, sizeof(*id));
+    return true;
+}
+
+bool serial_frame_receive_payload(uint8_t* payload, size_t size) {
+    uint8_t trailer[2];
+
+    if (size && !serial_transport_receive(payload, size)) {
+        return false;
+    }
+    if (!serial_transport_receive(trailer, sizeof(trailer))) {
+        return false;
+    }
+
+    receive_crc = serial_frame_crc16(receive_crc, payload, size);
+    return receive_crc == (trailer[0] | (uint16_t)trailer[1] << 8);
+}
@@ -0,0 +1,79 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined(SERIAL_FRAME_START)
+#    define SERIAL_FRAME_START 0xA5
+#endif
+
+#define SERIAL_FRAME_CRC16_INIT 0xFFFF
+
+/**
+ * @brief Circular receive buffer that is filled by a producer which only
+ * exposes its current write position, e.g. a DMA stream in circular mode. The
+ * producer never waits for the reader, an overrun silently overwrites unread
+ * data and has to be caught by the frame checksum.
+ */
+typedef struct {
+    const volatile uint8_t* buffer;
+    uint16_t                size;
+    uint16_t                tail;
+} serial_ring_t;
+
+/**
+ * @brief Number of unread bytes in the ring, given the producers write position.
+ */
+uint16_t serial_ring_available(const serial_ring_t* ring, uint16_t head);
+
+/**
+ * @brief Copies up to size unread bytes out of the ring.
+ *
+ * @return uint16_t Number of bytes copied.
+ */
+uint16_t serial_ring_read(serial_ring_t* ring, uint16_t head, uint8_t* destination, uint16_t size);
+
+/**
+ * @brief Drops all unread bytes.
+ */
+static inline void serial_ring_flush(serial_ring_t* ring, uint16_t head) {
+    ring->tail = head % ring->size;
+}
+
+/**
+ * @brief CRC-16/CCITT-FALSE over size bytes, start with SERIAL_FRAME_CRC16_INIT.
+ */
+uint16_t serial_frame_crc16(uint16_t crc, const uint8_t* data, size_t size);
+
+/**
+ * @brief Sends a frame consisting of the start byte, the id, size bytes of
+ * payload and the CRC16 of id and payload.
+ *
+ * @return true Send success.
+ * @return false Send failed, e.g. by timeout.
+ */
+bool serial_frame_send(uint8_t id, const uint8_t* payload, size_t size);
+
+/**
+ * @brief Receives the start byte and id of the next frame. With blocking set,
+ * this waits for a frame to arrive and skips anything that is not the start of
+ * a frame. Otherwise the next byte has to be the start of a frame.
+ *
+ * @return true The id was received.
+ * @return false Receive failed, e.g. by timeout or unexpected data.
+ */
+bool serial_frame_receive_header(uint8_t* id, bool blocking);
+
+/**
+ * @brief Receives size bytes of payload of the frame whose header was just
+ * received, and checks its CRC16. The payload is written even if the check
+ * fails, so it should not be received straight into live data.
+ *
+ * @return true The complete frame was received intact.
+ * @return false Receive failed, e.g. by timeout or checksum mismatch.
+ */
+bool serial_frame_receive_payload(uint8_t* payload, size_t size);
@@ -2,10 +2,14 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <ch.h>
+#include <string.h>
 
 #include "quantum.h"
 #include "serial.h"
 #include "serial_protocol.h"
+#if defined(SERIAL_USART_DMA)
+#    include "serial_frame.h"
+#endif
 #include "printf.h"
 #include "synchronization_util.h"
 
@@ -47,6 +51,59 @@ void soft_serial_initiator_init(void) {
     serial_transport_driver_master_init();
 }
 
+#if defined(SERIAL_USART_DMA)
+
+/* Every transaction buffer lies within the shared memory, so this holds any payload. */
+static uint8_t receive_scratch[sizeof(split_shared_memory_t)];
+
+/**
+ * @brief Receives the payload of a frame, and copies it into the destination
+ * only if the frame is intact. A corrupted frame never reaches the shared
+ * memory.
+ */
+static inline bool receive_payload(uint8_t* destination, size_t size) {
+    if (unlikely(!serial_frame_receive_payload(receive_scratch, size))) {
+        return false;
+    }
+    memcpy(destination, receive_scratch, size);
+    return true;
+}
+
+/**
+ * @brief React to transactions started by the master. Each direction is a
+ * single frame: the master sends the transaction id and buffer, the slave
+ * answers with the XORed id and its buffer.
+ */
+static inline bool react_to_transaction(void) {
+    uint8_t transaction_id = 0;
+    /* Wait until there is a transaction for us. */
+    if (unlikely(!serial_frame_receive_header(&transaction_id, true))) {
+        return false;
+    }
+
+    /* Sanity check that we are actually responding to a valid transaction. */
+    if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        return false;
+    }
+
+    split_shared_memory_lock_autounlock();
+
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+
+    if (unlikely(!receive_payload(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        return false;
+    }
+
+    /* Allow any slave processing to occur. */
+    if (transaction->slave_callback) {
+        transaction->slave_callback(transaction->initiator2target_buffer_size, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size, split_trans_target2initiator_buffer(transaction));
+    }
+
+    return serial_frame_send(transaction_id ^ NUM_TOTAL_TRANSACTIONS, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size);
+}
+
+#else
+
 /**
  * @brief React to transactions started by the master.
  */
@@ -95,6 +152,8 @@ static inline bool react_to_transaction(void) {
     return true;
 }
 
+#endif
+
 /**
  * @brief Start transaction from the master half to the slave half.
  *
@@ -113,6 +172,44 @@ bool soft_serial_transaction(int index) {
     return result;
 }
 
+#if defined(SERIAL_USART_DMA)
+
+/**
+ * @brief Initiate transaction to slave half.
+ */
+static inline bool initiate_transaction(uint8_t transaction_id) {
+    /* Sanity check that we are actually starting a valid transaction. */
+    if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        serial_dprintf("SPLIT: illegal transaction id\n");
+        return false;
+    }
+
+    split_shared_memory_lock_autounlock();
+
+    split_transaction_desc_t* transaction = &split_transaction_table[transaction_id];
+
+    if (unlikely(!serial_frame_send(transaction_id, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        serial_dprintf("SPLIT: sending frame failed\n");
+        return false;
+    }
+
+    /* The answer doubles as handshake, so write only transactions fail as well if the slave is not ready. */
+    uint8_t transaction_id_shake = 0xFF;
+    if (unlikely(!serial_frame_receive_header(&transaction_id_shake, false) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
+        serial_dprintf("SPLIT: receiving handshake failed\n");
+        return false;
+    }
+
+    if (unlikely(!receive_payload(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        serial_dprintf("SPLIT: receiving frame failed\n");
+        return false;
+    }
+
+    return true;
+}
+
+#else
+
 /**
  * @brief Initiate transaction to slave half.
  */
@@ -162,3 +259,5 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     return true;
 }
+
+#endif
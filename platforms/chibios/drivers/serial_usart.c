@@ -5,12 +5,15 @@
 #include "serial_usart.h"
 #include "serial_protocol.h"
 #include "synchronization_util.h"
+#if defined(SERIAL_USART_DMA)
+#    include "serial_frame.h"
+#endif
 
 #if defined(SERIAL_USART_CONFIG)
 static QMKSerialConfig serial_config = SERIAL_USART_CONFIG;
 #elif defined(MCU_STM32) /* STM32 MCUs */
 static QMKSerialConfig serial_config = {
-#    if HAL_USE_SERIAL
+#    if HAL_USE_SERIAL && !defined(SERIAL_USART_DMA)
     .speed = (SERIAL_USART_SPEED),
 #    else
     .baud = (SERIAL_USART_SPEED),
@@ -38,9 +41,192 @@ static QMKSerialConfig serial_config = {
 #    error MCU Familiy not supported by default, supply your own serial_config by defining SERIAL_USART_CONFIG in your keyboard files.
 #endif
 
-static QMKSerialDriver* serial_driver = (QMKSerialDriver*)&SERIAL_USART_DRIVER;
+#if defined(SERIAL_USART_DMA)
+
+static QMKSerialDriver* serial_driver = SERIAL_USART_DRIVER;
+
+#    if defined(USART_ISR_IDLE) /* USARTv2 and newer */
+#        define USART_DMA_RX_REGISTER RDR
+#        define USART_DMA_TX_REGISTER TDR
+#    else /* USARTv1 */
+#        define USART_DMA_RX_REGISTER DR
+#        define USART_DMA_TX_REGISTER DR
+#    endif
+
+#    define USART_DMA_RX_MODE (STM32_DMA_CR_CHSEL(SERIAL_USART_DMA_RX_CHANNEL) | STM32_DMA_CR_DIR_P2M | STM32_DMA_CR_PSIZE_BYTE | STM32_DMA_CR_MSIZE_BYTE | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_HTIE | STM32_DMA_CR_TCIE | STM32_DMA_CR_PL(3))
+#    define USART_DMA_TX_MODE (STM32_DMA_CR_CHSEL(SERIAL_USART_DMA_TX_CHANNEL) | STM32_DMA_CR_DIR_M2P | STM32_DMA_CR_PSIZE_BYTE | STM32_DMA_CR_MSIZE_BYTE | STM32_DMA_CR_MINC | STM32_DMA_CR_TCIE | STM32_DMA_CR_PL(2))
+
+static const stm32_dma_stream_t* rx_dma;
+static const stm32_dma_stream_t* tx_dma;
+
+/* The RX stream runs continuously in circular mode, the read position is
+ * tracked in software and the write position is derived from the remaining
+ * transfer count of the stream. */
+static volatile uint8_t   rx_buffer[SERIAL_USART_DMA_RX_BUFFER_SIZE];
+static serial_ring_t      rx_ring   = {.buffer = rx_buffer, .size = SERIAL_USART_DMA_RX_BUFFER_SIZE, .tail = 0};
+static thread_reference_t rx_thread = NULL;
+
+/* Data to send is queued in a ring which the TX stream drains in contiguous
+ * chunks, so senders only wait if the ring is full. */
+static uint8_t            tx_buffer[SERIAL_USART_DMA_TX_BUFFER_SIZE];
+static volatile uint16_t  tx_head   = 0;
+static volatile uint16_t  tx_tail   = 0;
+static volatile uint16_t  tx_chunk  = 0;
+static thread_reference_t tx_thread = NULL;
+
+static inline uint16_t usart_dma_rx_head(void) {
+    return SERIAL_USART_DMA_RX_BUFFER_SIZE - dmaStreamGetTransactionSize(rx_dma);
+}
+
+static void usart_dma_tx_start_chunkI(void) {
+    if (tx_chunk || tx_head == tx_tail) {
+        return;
+    }
+
+    tx_chunk = (tx_head > tx_tail ? tx_head : SERIAL_USART_DMA_TX_BUFFER_SIZE) - tx_tail;
+    dmaStreamSetMemory0(tx_dma, &tx_buffer[tx_tail]);
+    dmaStreamSetTransactionSize(tx_dma, tx_chunk);
+    dmaStreamSetMode(tx_dma, USART_DMA_TX_MODE);
+    dmaStreamEnable(tx_dma);
+}
+
+static void usart_dma_rx_event(void* param, uint32_t flags) {
+    (void)param;
+    (void)flags;
+    osalSysLockFromISR();
+    osalThreadResumeI(&rx_thread, MSG_OK);
+    osalSysUnlockFromISR();
+}
+
+static void usart_dma_tx_event(void* param, uint32_t flags) {
+    (void)param;
+    (void)flags;
+    osalSysLockFromISR();
+    dmaStreamDisable(tx_dma);
+    tx_tail  = (tx_tail + tx_chunk) % SERIAL_USART_DMA_TX_BUFFER_SIZE;
+    tx_chunk = 0;
+    usart_dma_tx_start_chunkI();
+    osalThreadResumeI(&tx_thread, MSG_OK);
+    osalSysUnlockFromISR();
+}
+
+/**
+ * @brief The line went idle after receiving data, which usually is the end of
+ * a frame. Wakes up the receiver so it doesn't have to wait for the DMA half
+ * or full transfer events.
+ */
+OSAL_IRQ_HANDLER(SERIAL_USART_DMA_IRQ_HANDLER) {
+    OSAL_IRQ_PROLOGUE();
 
-#if HAL_USE_SERIAL
+#    if defined(USART_ISR_IDLE)
+    serial_driver->ICR = USART_ICR_IDLECF | USART_ICR_ORECF | USART_ICR_FECF | USART_ICR_PECF;
+#    else
+    /* Reading the status and then the data register clears the flags. */
+    (void)serial_driver->SR;
+    (void)serial_driver->DR;
+#    endif
+
+    osalSysLockFromISR();
+    osalThreadResumeI(&rx_thread, MSG_OK);
+    osalSysUnlockFromISR();
+
+    OSAL_IRQ_EPILOGUE();
+}
+
+/**
+ * @brief DMA driver startup routine.
+ */
+static inline void usart_driver_start(void) {
+    SERIAL_USART_DMA_RCC_ENABLE();
+
+    rx_dma = dmaStreamAlloc(SERIAL_USART_DMA_RX_STREAM - STM32_DMA_STREAM(0), SERIAL_USART_DMA_IRQ_PRIORITY, usart_dma_rx_event, NULL);
+    tx_dma = dmaStreamAlloc(SERIAL_USART_DMA_TX_STREAM - STM32_DMA_STREAM(0), SERIAL_USART_DMA_IRQ_PRIORITY, usart_dma_tx_event, NULL);
+    osalDbgAssert(rx_dma != NULL && tx_dma != NULL, "unable to allocate DMA streams");
+
+#    if (STM32_DMA_SUPPORTS_DMAMUX == TRUE)
+    dmaSetRequestSource(rx_dma, SERIAL_USART_DMA_RX_DMAMUX_ID);
+    dmaSetRequestSource(tx_dma, SERIAL_USART_DMA_TX_DMAMUX_ID);
+#    endif
+
+    serial_driver->CR1 = 0;
+    serial_driver->BRR = (SERIAL_USART_DMA_CLOCK) / serial_config.baud;
+    serial_driver->CR2 = serial_config.cr2;
+    serial_driver->CR3 = serial_config.cr3 | USART_CR3_DMAR | USART_CR3_DMAT;
+
+    dmaStreamSetPeripheral(rx_dma, &serial_driver->USART_DMA_RX_REGISTER);
+    dmaStreamSetMemory0(rx_dma, rx_buffer);
+    dmaStreamSetTransactionSize(rx_dma, SERIAL_USART_DMA_RX_BUFFER_SIZE);
+    dmaStreamSetMode(rx_dma, USART_DMA_RX_MODE);
+    dmaStreamEnable(rx_dma);
+
+    dmaStreamSetPeripheral(tx_dma, &serial_driver->USART_DMA_TX_REGISTER);
+
+    serial_driver->CR1 = serial_config.cr1 | USART_CR1_UE | USART_CR1_TE | USART_CR1_RE | USART_CR1_IDLEIE;
+    nvicEnableVector(SERIAL_USART_DMA_IRQ_NUMBER, SERIAL_USART_DMA_IRQ_PRIORITY);
+}
+
+inline void serial_transport_driver_clear(void) {
+    osalSysLock();
+    serial_ring_flush(&rx_ring, usart_dma_rx_head());
+    osalSysUnlock();
+}
+
+static bool usart_dma_receive(uint8_t* destination, size_t size, sysinterval_t timeout) {
+    osalSysLock();
+    while (true) {
+        uint16_t received = serial_ring_read(&rx_ring, usart_dma_rx_head(), destination, size);
+        destination += received;
+        size -= received;
+
+        if (size == 0) {
+            break;
+        }
+
+        /* Wait for the idle line or a DMA half/full transfer event. */
+        if (osalThreadSuspendTimeoutS(&rx_thread, timeout) == MSG_TIMEOUT) {
+            break;
+        }
+    }
+    osalSysUnlock();
+
+    return size == 0;
+}
+
+inline bool serial_transport_send(const uint8_t* source, const size_t size) {
+    size_t remaining = size;
+
+    osalSysLock();
+    while (remaining) {
+        uint16_t space = (tx_tail + SERIAL_USART_DMA_TX_BUFFER_SIZE - tx_head - 1) % SERIAL_USART_DMA_TX_BUFFER_SIZE;
+        if (space == 0) {
+            if (osalThreadSuspendTimeoutS(&tx_thread, TIME_MS2I(SERIAL_USART_TIMEOUT)) == MSG_TIMEOUT) {
+                break;
+            }
+            continue;
+        }
+
+        for (; space && remaining; space--, remaining--) {
+            tx_buffer[tx_head] = *source++;
+            tx_head            = (tx_head + 1) % SERIAL_USART_DMA_TX_BUFFER_SIZE;
+        }
+        usart_dma_tx_start_chunkI();
+    }
+    osalSysUnlock();
+
+    return remaining == 0;
+}
+
+inline bool serial_transport_receive(uint8_t* destination, const size_t size) {
+    return usart_dma_receive(destination, size, TIME_MS2I(SERIAL_USART_TIMEOUT));
+}
+
+inline bool serial_transport_receive_blocking(uint8_t* destination, const size_t size) {
+    return usart_dma_receive(destination, size, TIME_INFINITE);
+}
+
+#elif HAL_USE_SERIAL
+
+static QMKSerialDriver* serial_driver = (QMKSerialDriver*)&SERIAL_USART_DRIVER;
 
 /**
  * @brief SERIAL Driver startup routine.
@@ -72,6 +258,8 @@ inline void serial_transport_driver_clear(void) {
 
 #elif HAL_USE_SIO
 
+static QMKSerialDriver* serial_driver = (QMKSerialDriver*)&SERIAL_USART_DRIVER;
+
 void clear_rx_evt_cb(SIODriver* siop) {
     osalSysLockFromISR();
     /* If errors occured during transactions this callback is invoked. We just
@@ -106,6 +294,8 @@ inline void serial_transport_driver_clear(void) {
 
 #endif
 
+#if !defined(SERIAL_USART_DMA)
+
 inline bool serial_transport_send(const uint8_t* source, const size_t size) {
     bool success = (size_t)chnWriteTimeout(serial_driver, source, size, TIME_MS2I(SERIAL_USART_TIMEOUT)) == size;
 
@@ -163,6 +353,8 @@ inline bool serial_transport_receive_blocking(uint8_t* destination, const size_t
     return success;
 }
 
+#endif
+
 #if !defined(SERIAL_USART_FULL_DUPLEX)
 
 /**
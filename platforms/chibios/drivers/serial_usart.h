@@ -45,7 +45,79 @@
 #    define SERIAL_USART_TIMEOUT 20
 #endif
 
-#if HAL_USE_SERIAL
+#if defined(SERIAL_USART_DMA)
+
+#    if !defined(MCU_STM32)
+#        error The DMA mode of the usart driver is only available on STM32 MCUs.
+#    endif
+
+#    if !defined(SERIAL_USART_FULL_DUPLEX)
+#        error The DMA mode of the usart driver requires SERIAL_USART_FULL_DUPLEX.
+#    endif
+
+/* The USART peripheral is driven directly, it must not be claimed by the SERIAL or SIO driver. */
+typedef USART_TypeDef QMKSerialDriver;
+
+typedef struct {
+    uint32_t baud;
+    uint32_t cr1;
+    uint32_t cr2;
+    uint32_t cr3;
+} QMKSerialConfig;
+
+#    if !defined(SERIAL_USART_DRIVER)
+#        define SERIAL_USART_DRIVER USART1
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_CLOCK)
+#        define SERIAL_USART_DMA_CLOCK STM32_PCLK2 // USART1 is clocked from APB2 on most STM32 MCUs
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_RCC_ENABLE)
+#        define SERIAL_USART_DMA_RCC_ENABLE() rccEnableUSART1(true)
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_IRQ_HANDLER)
+#        define SERIAL_USART_DMA_IRQ_HANDLER STM32_USART1_HANDLER
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_IRQ_NUMBER)
+#        define SERIAL_USART_DMA_IRQ_NUMBER STM32_USART1_NUMBER
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_IRQ_PRIORITY)
+#        define SERIAL_USART_DMA_IRQ_PRIORITY 12
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_RX_STREAM)
+#        define SERIAL_USART_DMA_RX_STREAM STM32_DMA1_STREAM5 // DMA stream for USART1_RX
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_RX_CHANNEL)
+#        define SERIAL_USART_DMA_RX_CHANNEL 0
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_TX_STREAM)
+#        define SERIAL_USART_DMA_TX_STREAM STM32_DMA1_STREAM4 // DMA stream for USART1_TX
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_TX_CHANNEL)
+#        define SERIAL_USART_DMA_TX_CHANNEL 0
+#    endif
+
+#    if (STM32_DMA_SUPPORTS_DMAMUX == TRUE) && (!defined(SERIAL_USART_DMA_RX_DMAMUX_ID) || !defined(SERIAL_USART_DMA_TX_DMAMUX_ID))
+#        error "please consult your MCU's datasheet and specify in your config.h: #define SERIAL_USART_DMA_RX_DMAMUX_ID STM32_DMAMUX1_USART?_RX and SERIAL_USART_DMA_TX_DMAMUX_ID STM32_DMAMUX1_USART?_TX"
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_RX_BUFFER_SIZE)
+#        define SERIAL_USART_DMA_RX_BUFFER_SIZE 128
+#    endif
+
+#    if !defined(SERIAL_USART_DMA_TX_BUFFER_SIZE)
+#        define SERIAL_USART_DMA_TX_BUFFER_SIZE 128
+#    endif
+
+#elif HAL_USE_SERIAL
 
 typedef SerialDriver QMKSerialDriver;
 typedef SerialConfig QMKSerialConfig;
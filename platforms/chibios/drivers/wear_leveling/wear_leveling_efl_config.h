@@ -41,6 +41,13 @@
 #    endif
 #endif
 
+// Work out the size of each erase, only known up front on families with uniform sectors
+#ifndef BACKING_STORE_ERASE_SIZE
+#    if defined(QMK_MCU_FAMILY_STM32) && defined(STM32_FLASH_SECTOR_SIZE) // from some family's stm32_registry.h file
+#        define BACKING_STORE_ERASE_SIZE (STM32_FLASH_SECTOR_SIZE)
+#    endif
+#endif
+
 // 2kB backing space allocated
 #ifndef WEAR_LEVELING_BACKING_SIZE
 #    define WEAR_LEVELING_BACKING_SIZE 2048
@@ -0,0 +1,140 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ring_buffer.h"
+}
+
+#include <atomic>
+#include <thread>
+
+typedef struct {
+    uint8_t  kind;
+    uint16_t value;
+} event_t;
+
+RING_BUFFER_DECLARE(byte_ring, uint8_t, 8);
+RING_BUFFER_DECLARE(event_ring, event_t, 4);
+RING_BUFFER_DECLARE(large_ring, uint32_t, 128);
+
+class RingBuffer : public testing::Test {
+   protected:
+    void SetUp() override {
+        byte_ring_init(&bytes);
+        event_ring_init(&events);
+    }
+
+    byte_ring_t  bytes;
+    event_ring_t events;
+};
+
+TEST_F(RingBuffer, StartsEmpty) {
+    uint8_t value = 0xAA;
+    EXPECT_TRUE(byte_ring_empty(&bytes));
+    EXPECT_EQ(byte_ring_count(&bytes), 0);
+    EXPECT_FALSE(byte_ring_peek(&bytes, &value));
+    EXPECT_FALSE(byte_ring_pop(&bytes, &value));
+    EXPECT_EQ(value, 0xAA);
+}
+
+TEST_F(RingBuffer, UsesEverySlot) {
+    for (uint8_t i = 0; i < 8; i++) {
+        EXPECT_TRUE(byte_ring_push(&bytes, i));
+    }
+    EXPECT_FALSE(byte_ring_push(&bytes, 8));
+    EXPECT_EQ(byte_ring_count(&bytes), 8);
+
+    uint8_t value;
+    for (uint8_t i = 0; i < 8; i++) {
+        EXPECT_TRUE(byte_ring_pop(&bytes, &value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_TRUE(byte_ring_empty(&bytes));
+}
+
+TEST_F(RingBuffer, PeekDoesNotConsume) {
+    uint8_t value = 0;
+    byte_ring_push(&bytes, 42);
+    EXPECT_TRUE(byte_ring_peek(&bytes, &value));
+    EXPECT_EQ(value, 42);
+    EXPECT_EQ(byte_ring_count(&bytes), 1);
+    EXPECT_TRUE(byte_ring_pop(&bytes, &value));
+    EXPECT_EQ(value, 42);
+    EXPECT_TRUE(byte_ring_empty(&bytes));
+}
+
+TEST_F(RingBuffer, WrapsAroundIndices) {
+    uint8_t value;
+    /* Enough iterations for both 8-bit indices to overflow several times,
+     * at every fill level. */
+    for (unsigned i = 0; i < 1000; i++) {
+        uint8_t fill = i % 8 + 1;
+        for (uint8_t j = 0; j < fill; j++) {
+            ASSERT_TRUE(byte_ring_push(&bytes, i + j));
+        }
+        ASSERT_EQ(byte_ring_count(&bytes), fill);
+        for (uint8_t j = 0; j < fill; j++) {
+            ASSERT_TRUE(byte_ring_pop(&bytes, &value));
+            ASSERT_EQ(value, (uint8_t)(i + j));
+        }
+        ASSERT_TRUE(byte_ring_empty(&bytes));
+    }
+}
+
+TEST_F(RingBuffer, ClearDropsPending) {
+    uint8_t value;
+    byte_ring_push(&bytes, 1);
+    byte_ring_push(&bytes, 2);
+    byte_ring_clear(&bytes);
+    EXPECT_TRUE(byte_ring_empty(&bytes));
+    EXPECT_FALSE(byte_ring_pop(&bytes, &value));
+
+    EXPECT_TRUE(byte_ring_push(&bytes, 3));
+    EXPECT_TRUE(byte_ring_pop(&bytes, &value));
+    EXPECT_EQ(value, 3);
+}
+
+TEST_F(RingBuffer, StoresStructs) {
+    event_t event;
+    for (uint16_t i = 0; i < 4; i++) {
+        EXPECT_TRUE(event_ring_push(&events, event_t{(uint8_t)i, (uint16_t)(i * 1000)}));
+    }
+    EXPECT_FALSE(event_ring_push(&events, event_t{0, 0}));
+    for (uint16_t i = 0; i < 4; i++) {
+        EXPECT_TRUE(event_ring_pop(&events, &event));
+        EXPECT_EQ(event.kind, i);
+        EXPECT_EQ(event.value, i * 1000);
+    }
+}
+
+TEST_F(RingBuffer, ConcurrentProducerAndConsumer) {
+    static large_ring_t ring;
+    const uint32_t      total = 1000000;
+    std::atomic<bool>   stop(false);
+    large_ring_init(&ring);
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < total && !stop;) {
+            if (large_ring_push(&ring, i)) {
+                i++;
+            }
+        }
+    });
+
+    uint32_t expected = 0;
+    uint32_t value;
+    while (expected < total) {
+        if (large_ring_pop(&ring, &value)) {
+            if (value != expected) {
+                break;
+            }
+            expected++;
+        }
+    }
+    stop = true;
+    producer.join();
+    EXPECT_EQ(expected, total);
+    EXPECT_TRUE(large_ring_empty(&ring));
+}
@@ -23,3 +23,14 @@ eeprom_stm32_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_stm32.c
 eeprom_stm32_tiny_SRC := $(eeprom_stm32_SRC)
 eeprom_stm32_large_SRC := $(eeprom_stm32_SRC)
+
+serial_frame_DEFS := -DNO_PRINT
+serial_frame_INC := $(PLATFORM_PATH)/chibios/drivers/
+serial_frame_SRC := \
+	$(PLATFORM_PATH)/chibios/drivers/serial_frame.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/serial_loopback.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/serial_frame_tests.cpp
+
+ring_buffer_DEFS := -DNO_PRINT
+ring_buffer_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/ring_buffer_tests.cpp
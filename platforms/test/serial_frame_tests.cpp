@@ -0,0 +1,151 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "serial_frame.h"
+#include "serial_protocol.h"
+#include "serial_loopback.h"
+}
+
+#include <vector>
+
+class SerialFrame : public testing::Test {
+   protected:
+    void SetUp() override {
+        serial_loopback_reset();
+    }
+
+    void send(serial_loopback_side_t side, uint8_t id, const std::vector<uint8_t>& payload) {
+        serial_loopback_select(side);
+        EXPECT_TRUE(serial_frame_send(id, payload.data(), payload.size()));
+    }
+
+    bool receive(serial_loopback_side_t side, uint8_t id, std::vector<uint8_t>& payload, bool blocking = true) {
+        uint8_t received_id = 0xFF;
+        serial_loopback_select(side);
+        if (!serial_frame_receive_header(&received_id, blocking)) {
+            return false;
+        }
+        EXPECT_EQ(received_id, id);
+        return serial_frame_receive_payload(payload.data(), payload.size());
+    }
+};
+
+TEST_F(SerialFrame, Crc16MatchesCcittFalse) {
+    const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    EXPECT_EQ(serial_frame_crc16(SERIAL_FRAME_CRC16_INIT, check, sizeof(check)), 0x29B1);
+}
+
+TEST_F(SerialFrame, RoundTrip) {
+    std::vector<uint8_t> request = {1, 2, 3, SERIAL_FRAME_START, 5};
+    std::vector<uint8_t> answer  = {0xDE, 0xAD};
+    std::vector<uint8_t> received_request(request.size());
+    std::vector<uint8_t> received_answer(answer.size());
+
+    send(SERIAL_LOOPBACK_MASTER, 7, request);
+    ASSERT_TRUE(receive(SERIAL_LOOPBACK_SLAVE, 7, received_request));
+    EXPECT_EQ(received_request, request);
+
+    send(SERIAL_LOOPBACK_SLAVE, 7 ^ 0x80, answer);
+    ASSERT_TRUE(receive(SERIAL_LOOPBACK_MASTER, 7 ^ 0x80, received_answer, false));
+    EXPECT_EQ(received_answer, answer);
+
+    EXPECT_EQ(serial_loopback_pending(SERIAL_LOOPBACK_MASTER), 0);
+    EXPECT_EQ(serial_loopback_pending(SERIAL_LOOPBACK_SLAVE), 0);
+}
+
+TEST_F(SerialFrame, EmptyPayload) {
+    std::vector<uint8_t> empty;
+
+    send(SERIAL_LOOPBACK_MASTER, 3, empty);
+    EXPECT_EQ(serial_loopback_pending(SERIAL_LOOPBACK_SLAVE), 4);
+    EXPECT_TRUE(receive(SERIAL_LOOPBACK_SLAVE, 3, empty));
+}
+
+TEST_F(SerialFrame, FullDuplex) {
+    std::vector<uint8_t> from_master = {1, 2, 3};
+    std::vector<uint8_t> from_slave  = {4, 5, 6, 7};
+    std::vector<uint8_t> at_slave(from_master.size());
+    std::vector<uint8_t> at_master(from_slave.size());
+
+    /* Both directions in flight at the same time. */
+    send(SERIAL_LOOPBACK_MASTER, 1, from_master);
+    send(SERIAL_LOOPBACK_SLAVE, 2, from_slave);
+
+    ASSERT_TRUE(receive(SERIAL_LOOPBACK_MASTER, 2, at_master));
+    ASSERT_TRUE(receive(SERIAL_LOOPBACK_SLAVE, 1, at_slave));
+    EXPECT_EQ(at_master, from_slave);
+    EXPECT_EQ(at_slave, from_master);
+}
+
+TEST_F(SerialFrame, WrapsAroundReceiveBuffer) {
+    std::vector<uint8_t> payload(SERIAL_LOOPBACK_BUFFER_SIZE / 3);
+    std::vector<uint8_t> received(payload.size());
+
+    for (unsigned i = 0; i < 100; i++) {
+        for (size_t j = 0; j < payload.size(); j++) {
+            payload[j] = i + j;
+        }
+        send(SERIAL_LOOPBACK_MASTER, i % 32, payload);
+        ASSERT_TRUE(receive(SERIAL_LOOPBACK_SLAVE, i % 32, received)) << "frame " << i;
+        EXPECT_EQ(received, payload);
+    }
+}
+
+TEST_F(SerialFrame, CorruptedPayloadFailsChecksum) {
+    std::vector<uint8_t> payload = {1, 2, 3, 4};
+    std::vector<uint8_t> received(payload.size());
+
+    for (uint16_t offset = 0; offset < payload.size() + 2; offset++) {
+        send(SERIAL_LOOPBACK_MASTER, 5, payload);
+        serial_loopback_corrupt(SERIAL_LOOPBACK_SLAVE, offset, 0x10);
+        EXPECT_FALSE(receive(SERIAL_LOOPBACK_SLAVE, 5, received)) << "offset " << offset;
+    }
+}
+
+TEST_F(SerialFrame, TruncatedFrameTimesOut) {
+    std::vector<uint8_t> payload = {1, 2, 3, 4};
+    std::vector<uint8_t> received(payload.size() + 1);
+
+    send(SERIAL_LOOPBACK_MASTER, 5, payload);
+    EXPECT_FALSE(receive(SERIAL_LOOPBACK_SLAVE, 5, received));
+}
+
+TEST_F(SerialFrame, SlaveSkipsGarbage) {
+    const uint8_t        garbage[] = {0x00, 0x13, 0x37, 0xFF};
+    std::vector<uint8_t> payload   = {9, 8, 7};
+    std::vector<uint8_t> received(payload.size());
+
+    serial_loopback_inject(SERIAL_LOOPBACK_SLAVE, garbage, sizeof(garbage));
+    send(SERIAL_LOOPBACK_MASTER, 4, payload);
+    ASSERT_TRUE(receive(SERIAL_LOOPBACK_SLAVE, 4, received));
+    EXPECT_EQ(received, payload);
+}
+
+TEST_F(SerialFrame, MasterRejectsGarbage) {
+    const uint8_t garbage[] = {0x00};
+    uint8_t       id;
+
+    serial_loopback_inject(SERIAL_LOOPBACK_MASTER, garbage, sizeof(garbage));
+    serial_loopback_select(SERIAL_LOOPBACK_MASTER);
+    EXPECT_FALSE(serial_frame_receive_header(&id, false));
+}
+
+TEST_F(SerialFrame, RecoversFromOverrun) {
+    std::vector<uint8_t> payload(SERIAL_LOOPBACK_BUFFER_SIZE / 2);
+    std::vector<uint8_t> received(payload.size());
+
+    /* The receiver falls behind, the second frame overwrites the first. */
+    send(SERIAL_LOOPBACK_MASTER, 1, payload);
+    send(SERIAL_LOOPBACK_MASTER, 2, payload);
+    EXPECT_FALSE(receive(SERIAL_LOOPBACK_SLAVE, 1, received));
+
+    serial_loopback_select(SERIAL_LOOPBACK_SLAVE);
+    serial_transport_driver_clear();
+    EXPECT_EQ(serial_loopback_pending(SERIAL_LOOPBACK_SLAVE), 0);
+
+    send(SERIAL_LOOPBACK_MASTER, 3, payload);
+    EXPECT_TRUE(receive(SERIAL_LOOPBACK_SLAVE, 3, received));
+}
@@ -0,0 +1,61 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+#include "serial_loopback.h"
+#include "serial_frame.h"
+#include "serial_protocol.h"
+
+static volatile uint8_t       wire_buffer[2][SERIAL_LOOPBACK_BUFFER_SIZE];
+static uint16_t               wire_head[2];
+static serial_ring_t          wire_ring[2];
+static serial_loopback_side_t selected = SERIAL_LOOPBACK_MASTER;
+
+void serial_loopback_reset(void) {
+    for (uint8_t side = 0; side < 2; side++) {
+        wire_head[side] = 0;
+        wire_ring[side] = (serial_ring_t){.buffer = wire_buffer[side], .size = SERIAL_LOOPBACK_BUFFER_SIZE, .tail = 0};
+    }
+    selected = SERIAL_LOOPBACK_MASTER;
+}
+
+void serial_loopback_select(serial_loopback_side_t side) {
+    selected = side;
+}
+
+void serial_loopback_inject(serial_loopback_side_t side, const uint8_t* data, size_t size) {
+    while (size--) {
+        wire_buffer[side][wire_head[side]] = *data++;
+        wire_head[side]                    = (wire_head[side] + 1) % SERIAL_LOOPBACK_BUFFER_SIZE;
+    }
+}
+
+void serial_loopback_corrupt(serial_loopback_side_t side, uint16_t offset, uint8_t mask) {
+    uint16_t index = (wire_head[side] + 2 * SERIAL_LOOPBACK_BUFFER_SIZE - 1 - offset) % SERIAL_LOOPBACK_BUFFER_SIZE;
+    wire_buffer[side][index] ^= mask;
+}
+
+uint16_t serial_loopback_pending(serial_loopback_side_t side) {
+    return serial_ring_available(&wire_ring[side], wire_head[side]);
+}
+
+void serial_transport_driver_clear(void) {
+    serial_ring_flush(&wire_ring[selected], wire_head[selected]);
+}
+
+void serial_transport_driver_slave_init(void) {}
+
+void serial_transport_driver_master_init(void) {}
+
+bool serial_transport_send(const uint8_t* source, const size_t size) {
+    serial_loopback_inject(selected == SERIAL_LOOPBACK_MASTER ? SERIAL_LOOPBACK_SLAVE : SERIAL_LOOPBACK_MASTER, source, size);
+    return true;
+}
+
+bool serial_transport_receive(uint8_t* destination, const size_t size) {
+    return serial_ring_read(&wire_ring[selected], wire_head[selected], destination, size) == size;
+}
+
+bool serial_transport_receive_blocking(uint8_t* destination, const size_t size) {
+    return serial_transport_receive(destination, size);
+}
@@ -0,0 +1,42 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if !defined(SERIAL_LOOPBACK_BUFFER_SIZE)
+#    define SERIAL_LOOPBACK_BUFFER_SIZE 64
+#endif
+
+/*
+ * Host stand-in for the DMA usart driver: two wires, each ending in a circular
+ * receive buffer that is written like a DMA stream in circular mode would,
+ * i.e. without ever waiting for the reader. The serial_transport_* functions
+ * act on the side selected with serial_loopback_select(), and receiving fails
+ * immediately instead of timing out if not enough data has arrived.
+ */
+
+typedef enum {
+    SERIAL_LOOPBACK_MASTER,
+    SERIAL_LOOPBACK_SLAVE,
+} serial_loopback_side_t;
+
+void serial_loopback_reset(void);
+void serial_loopback_select(serial_loopback_side_t side);
+
+/**
+ * @brief Puts data on the wire towards side, e.g. noise.
+ */
+void serial_loopback_inject(serial_loopback_side_t side, const uint8_t* data, size_t size);
+
+/**
+ * @brief Flips mask in the byte offset bytes before the last one received by side.
+ */
+void serial_loopback_corrupt(serial_loopback_side_t side, uint16_t offset, uint8_t mask);
+
+/**
+ * @brief Number of unread bytes received by side.
+ */
+uint16_t serial_loopback_pending(serial_loopback_side_t side);
@@ -0,0 +1,66 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "host.h"
+#include "timer.h"
+#include "simulator.h"
+
+static uint8_t host_leds = 0;
+
+static uint8_t sim_keyboard_leds(void) {
+    return host_leds;
+}
+
+static void sim_send_keyboard(report_keyboard_t *report) {
+    sim_stats.reports++;
+    if (!sim_output) {
+        return;
+    }
+    fprintf(sim_output, "%u keyboard %02X", (unsigned)timer_read32(), report->mods);
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i]) {
+            fprintf(sim_output, " %02X", report->keys[i]);
+        }
+    }
+    fputc('\n', sim_output);
+}
+
+static void sim_send_mouse(report_mouse_t *report) {
+    sim_stats.reports++;
+    if (!sim_output) {
+        return;
+    }
+    fprintf(sim_output, "%u mouse %02X %d %d %d %d\n", (unsigned)timer_read32(), report->buttons, report->x, report->y, report->v, report->h);
+}
+
+static void sim_send_system(uint16_t data) {
+    sim_stats.reports++;
+    if (sim_output) {
+        fprintf(sim_output, "%u system %04X\n", (unsigned)timer_read32(), data);
+    }
+}
+
+static void sim_send_consumer(uint16_t data) {
+    sim_stats.reports++;
+    if (sim_output) {
+        fprintf(sim_output, "%u consumer %04X\n", (unsigned)timer_read32(), data);
+    }
+}
+
+static void sim_send_programmable_button(uint32_t data) {
+    sim_stats.reports++;
+    if (sim_output) {
+        fprintf(sim_output, "%u programmable_button %08X\n", (unsigned)timer_read32(), (unsigned)data);
+    }
+}
+
+static host_driver_t sim_driver = {sim_keyboard_leds, sim_send_keyboard, sim_send_mouse, sim_send_system, sim_send_consumer, sim_send_programmable_button};
+
+void sim_host_init(void) {
+    host_leds = 0;
+    host_set_driver(&sim_driver);
+}
+
+void sim_host_set_leds(uint8_t leds) {
+    host_leds = leds;
+}
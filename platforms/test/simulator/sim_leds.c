@@ -0,0 +1,91 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "simulator.h"
+
+/* Indicator LEDs, recorded whenever the host LED state is applied. */
+bool led_update_kb(led_t led_state) {
+    bool res = led_update_user(led_state);
+    if (sim_output) {
+        fprintf(sim_output, "%u leds %02X\n", (unsigned)timer_read32(), led_state.raw);
+    }
+    return res;
+}
+
+#ifdef RGB_MATRIX_ENABLE
+static RGB      rgb_matrix_framebuffer[DRIVER_LED_TOTAL];
+static uint32_t rgb_matrix_flushes = 0;
+
+static void sim_rgb_matrix_init(void) {}
+
+static void sim_rgb_matrix_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    rgb_matrix_framebuffer[index] = (RGB){.r = r, .g = g, .b = b};
+}
+
+static void sim_rgb_matrix_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < DRIVER_LED_TOTAL; i++) {
+        sim_rgb_matrix_set_color(i, r, g, b);
+    }
+}
+
+static void sim_rgb_matrix_flush(void) {
+    rgb_matrix_flushes++;
+}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = sim_rgb_matrix_init,
+    .set_color     = sim_rgb_matrix_set_color,
+    .set_color_all = sim_rgb_matrix_set_color_all,
+    .flush         = sim_rgb_matrix_flush,
+};
+#endif
+
+#ifdef LED_MATRIX_ENABLE
+static uint8_t  led_matrix_framebuffer[DRIVER_LED_TOTAL];
+static uint32_t led_matrix_flushes = 0;
+
+static void sim_led_matrix_init(void) {}
+
+static void sim_led_matrix_set_value(int index, uint8_t value) {
+    led_matrix_framebuffer[index] = value;
+}
+
+static void sim_led_matrix_set_value_all(uint8_t value) {
+    for (int i = 0; i < DRIVER_LED_TOTAL; i++) {
+        sim_led_matrix_set_value(i, value);
+    }
+}
+
+static void sim_led_matrix_flush(void) {
+    led_matrix_flushes++;
+}
+
+const led_matrix_driver_t led_matrix_driver = {
+    .init          = sim_led_matrix_init,
+    .set_value     = sim_led_matrix_set_value,
+    .set_value_all = sim_led_matrix_set_value_all,
+    .flush         = sim_led_matrix_flush,
+};
+#endif
+
+/* Writes the framebuffers of the enabled matrix lighting features. */
+void sim_leds_dump(void) {
+    if (!sim_output) {
+        return;
+    }
+#ifdef RGB_MATRIX_ENABLE
+    fprintf(sim_output, "%u rgb_matrix %u", (unsigned)timer_read32(), (unsigned)rgb_matrix_flushes);
+    for (int i = 0; i < DRIVER_LED_TOTAL; i++) {
+        fprintf(sim_output, " %02X%02X%02X", rgb_matrix_framebuffer[i].r, rgb_matrix_framebuffer[i].g, rgb_matrix_framebuffer[i].b);
+    }
+    fputc('\n', sim_output);
+#endif
+#ifdef LED_MATRIX_ENABLE
+    fprintf(sim_output, "%u led_matrix %u", (unsigned)timer_read32(), (unsigned)led_matrix_flushes);
+    for (int i = 0; i < DRIVER_LED_TOTAL; i++) {
+        fprintf(sim_output, " %02X", led_matrix_framebuffer[i]);
+    }
+    fputc('\n', sim_output);
+#endif
+}
@@ -0,0 +1,54 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "matrix.h"
+#include "simulator.h"
+
+static matrix_row_t matrix[MATRIX_ROWS] = {};
+
+void matrix_init(void) {
+    sim_matrix_clear();
+    matrix_init_quantum();
+}
+
+uint8_t matrix_scan(void) {
+    matrix_scan_quantum();
+    return 1;
+}
+
+matrix_row_t matrix_get_row(uint8_t row) {
+    return matrix[row];
+}
+
+void matrix_print(void) {}
+
+__attribute__((weak)) void matrix_init_kb(void) {
+    matrix_init_user();
+}
+
+__attribute__((weak)) void matrix_scan_kb(void) {
+    matrix_scan_user();
+}
+
+__attribute__((weak)) void matrix_init_user(void) {}
+
+__attribute__((weak)) void matrix_scan_user(void) {}
+
+void sim_matrix_press(uint8_t row, uint8_t col) {
+    if (row < MATRIX_ROWS && col < MATRIX_COLS) {
+        matrix[row] |= (matrix_row_t)1 << col;
+        sim_stats.events++;
+    }
+}
+
+void sim_matrix_release(uint8_t row, uint8_t col) {
+    if (row < MATRIX_ROWS && col < MATRIX_COLS) {
+        matrix[row] &= ~((matrix_row_t)1 << col);
+        sim_stats.events++;
+    }
+}
+
+void sim_matrix_clear(void) {
+    memset(matrix, 0, sizeof(matrix));
+}
@@ -0,0 +1,69 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "simulator.h"
+#include "sim_trace.h"
+
+static void sim_trace_execute(sim_trace_t *trace) {
+    uint32_t remaining[SIM_TRACE_MAX_NESTING];
+    uint8_t  depth = 0;
+
+    for (uint32_t pc = 0; pc < trace->count; pc++) {
+        sim_command_t *command = &trace->commands[pc];
+        switch (command->kind) {
+            case SIM_PRESS:
+                sim_matrix_press(command->row, command->col);
+                break;
+            case SIM_RELEASE:
+                sim_matrix_release(command->row, command->col);
+                break;
+            case SIM_TAP:
+                sim_matrix_press(command->row, command->col);
+                sim_scan(command->value);
+                sim_matrix_release(command->row, command->col);
+                sim_scan(1);
+                break;
+            case SIM_WAIT:
+                sim_scan(command->value);
+                break;
+            case SIM_LEDS:
+                sim_host_set_leds(command->value);
+                break;
+            case SIM_DUMP:
+                sim_leds_dump();
+                break;
+            case SIM_PRINT:
+                if (sim_output) {
+                    fprintf(sim_output, "%u print %s\n", (unsigned)sim_time(), command->text);
+                }
+                break;
+            case SIM_REPEAT:
+                if (command->value == 0) {
+                    pc = command->match;
+                } else {
+                    remaining[depth++] = command->value;
+                }
+                break;
+            case SIM_END:
+                if (--remaining[depth - 1] > 0) {
+                    pc = command->match;
+                } else {
+                    depth--;
+                }
+                break;
+        }
+    }
+}
+
+/** \brief Loads and runs a trace file, returns false if it couldn't be parsed */
+bool sim_trace_run(const char *path) {
+    sim_trace_t trace = {0};
+    bool        ok    = sim_trace_load(&trace, path);
+    if (ok) {
+        sim_trace_execute(&trace);
+    } else {
+        fprintf(stderr, "%s\n", trace.error);
+    }
+    sim_trace_free(&trace);
+    return ok;
+}
@@ -0,0 +1,67 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Trace files are plain text, one command per line, `#` starts a comment:
+ *
+ *   press <row> <col>         close a switch in the virtual matrix
+ *   release <row> <col>       open it again
+ *   tap <row> <col> [<ms>]    press, hold for <ms> (default 1), release, scan once
+ *   wait <ms>                 run one matrix scan per millisecond
+ *   leds <value>              set the host's keyboard LED state
+ *   dump                      write the LED matrix framebuffers
+ *   print <text>              copy <text> to the output
+ *   repeat <count>            run the commands up to the matching `end`
+ *   end                       <count> times, blocks can be nested
+ *
+ * Matrix transitions take effect on the next scan, like a real switch.
+ */
+
+#define SIM_TRACE_MAX_NESTING 16
+
+typedef enum {
+    SIM_PRESS,
+    SIM_RELEASE,
+    SIM_TAP,
+    SIM_WAIT,
+    SIM_LEDS,
+    SIM_DUMP,
+    SIM_PRINT,
+    SIM_REPEAT,
+    SIM_END,
+} sim_command_kind_t;
+
+typedef struct {
+    sim_command_kind_t kind;
+    uint8_t            row;
+    uint8_t            col;
+    uint32_t           value; // milliseconds, LED state or repeat count
+    uint32_t           match; // index of the matching repeat/end
+    char *             text;
+} sim_command_t;
+
+typedef struct {
+    sim_command_t *commands;
+    uint32_t       count;
+    uint32_t       capacity;
+    char           error[128]; // why sim_trace_load() failed
+} sim_trace_t;
+
+/** \brief Parses a trace file, returns false and sets `error` if it can't be read or is invalid */
+bool sim_trace_load(sim_trace_t *trace, const char *path);
+
+/** \brief Frees the commands of a trace */
+void sim_trace_free(sim_trace_t *trace);
+
+#ifdef __cplusplus
+}
+#endif
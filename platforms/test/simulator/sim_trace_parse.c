@@ -0,0 +1,131 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "matrix.h"
+#include "sim_trace.h"
+
+#define SIM_TRACE_LINE_LENGTH 256
+
+void sim_trace_free(sim_trace_t *trace) {
+    for (uint32_t i = 0; i < trace->count; i++) {
+        free(trace->commands[i].text);
+    }
+    free(trace->commands);
+}
+
+static sim_command_t *sim_trace_append(sim_trace_t *trace) {
+    if (trace->count == trace->capacity) {
+        trace->capacity = trace->capacity ? trace->capacity * 2 : 64;
+        trace->commands = realloc(trace->commands, trace->capacity * sizeof(sim_command_t));
+        if (!trace->commands) {
+            fprintf(stderr, "simulator: out of memory\n");
+            exit(1);
+        }
+    }
+    sim_command_t *command = &trace->commands[trace->count++];
+    memset(command, 0, sizeof(sim_command_t));
+    return command;
+}
+
+static bool sim_trace_parse_line(sim_trace_t *trace, char *line, uint32_t *stack, uint8_t *depth) {
+    char *comment = strchr(line, '#');
+    if (comment) {
+        *comment = '\0';
+    }
+
+    char     name[16];
+    int      consumed = 0;
+    unsigned a = 0, b = 0, c = 0;
+    if (sscanf(line, " %15s%n", name, &consumed) != 1) {
+        return true; // blank line
+    }
+    char *arguments = line + consumed;
+    int   count     = sscanf(arguments, "%u %u %u", &a, &b, &c);
+
+    sim_command_t *command = sim_trace_append(trace);
+    if (strcmp(name, "press") == 0 || strcmp(name, "release") == 0) {
+        if (count != 2 || a >= MATRIX_ROWS || b >= MATRIX_COLS) {
+            return false;
+        }
+        command->kind = name[0] == 'p' ? SIM_PRESS : SIM_RELEASE;
+        command->row  = a;
+        command->col  = b;
+    } else if (strcmp(name, "tap") == 0) {
+        if (count < 2 || a >= MATRIX_ROWS || b >= MATRIX_COLS) {
+            return false;
+        }
+        command->kind  = SIM_TAP;
+        command->row   = a;
+        command->col   = b;
+        command->value = count == 3 && c > 0 ? c : 1;
+    } else if (strcmp(name, "wait") == 0) {
+        if (count != 1) {
+            return false;
+        }
+        command->kind  = SIM_WAIT;
+        command->value = a;
+    } else if (strcmp(name, "leds") == 0) {
+        int leds;
+        if (sscanf(arguments, "%i", &leds) != 1) {
+            return false;
+        }
+        command->kind  = SIM_LEDS;
+        command->value = leds;
+    } else if (strcmp(name, "dump") == 0) {
+        command->kind = SIM_DUMP;
+    } else if (strcmp(name, "print") == 0) {
+        arguments += strspn(arguments, " \t");
+        arguments[strcspn(arguments, "\r\n")] = '\0';
+        command->kind                         = SIM_PRINT;
+        command->text                         = strdup(arguments);
+    } else if (strcmp(name, "repeat") == 0) {
+        if (count != 1 || *depth == SIM_TRACE_MAX_NESTING) {
+            return false;
+        }
+        command->kind     = SIM_REPEAT;
+        command->value    = a;
+        stack[(*depth)++] = trace->count - 1;
+    } else if (strcmp(name, "end") == 0) {
+        if (*depth == 0) {
+            return false;
+        }
+        uint32_t start               = stack[--(*depth)];
+        command->kind                = SIM_END;
+        command->match               = start;
+        trace->commands[start].match = trace->count - 1;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool sim_trace_load(sim_trace_t *trace, const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        snprintf(trace->error, sizeof(trace->error), "%s: can't open trace", path);
+        return false;
+    }
+
+    char     line[SIM_TRACE_LINE_LENGTH];
+    uint32_t stack[SIM_TRACE_MAX_NESTING];
+    uint8_t  depth  = 0;
+    uint32_t number = 0;
+    bool     ok     = true;
+    while (ok && fgets(line, sizeof(line), file)) {
+        number++;
+        if (!sim_trace_parse_line(trace, line, stack, &depth)) {
+            snprintf(trace->error, sizeof(trace->error), "%s:%u: invalid command", path, (unsigned)number);
+            ok = false;
+        }
+    }
+    if (ok && depth) {
+        snprintf(trace->error, sizeof(trace->error), "%s: missing end", path);
+        ok = false;
+    }
+    fclose(file);
+    return ok;
+}
+
@@ -0,0 +1,157 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "debug.h"
+#include "eeconfig.h"
+#include "keyboard.h"
+#include "timer.h"
+#include "simulator.h"
+
+void advance_time(uint32_t ms);
+
+FILE *      sim_output = NULL;
+sim_stats_t sim_stats  = {0};
+
+int8_t sendchar(uint8_t c) {
+    fputc(c, stderr);
+    return 0;
+}
+
+void sim_init(void) {
+    print_set_sendchar(sendchar);
+    timer_init();
+    sim_host_init();
+    eeconfig_init_quantum();
+    keyboard_init();
+}
+
+/** \brief Runs the main loop, each iteration takes one millisecond of virtual time */
+void sim_scan(uint32_t count) {
+    while (count--) {
+        keyboard_task();
+        advance_time(1);
+        sim_stats.scans++;
+    }
+}
+
+uint32_t sim_time(void) {
+    return timer_read32();
+}
+
+/** \brief Compares the output of a run with the expected output, line by line */
+static bool sim_compare(FILE *actual, const char *expected_path) {
+    FILE *expected = fopen(expected_path, "r");
+    if (!expected) {
+        fprintf(stderr, "simulator: can't open %s\n", expected_path);
+        return false;
+    }
+
+    char     actual_line[256], expected_line[256];
+    unsigned line = 0;
+    bool     same = true;
+    rewind(actual);
+    while (same) {
+        char *a = fgets(actual_line, sizeof(actual_line), actual);
+        char *e = fgets(expected_line, sizeof(expected_line), expected);
+        line++;
+        if (!a && !e) {
+            break;
+        }
+        if (!a || !e || strcmp(actual_line, expected_line) != 0) {
+            fprintf(stderr, "%s:%u: expected: %s", expected_path, line, e ? expected_line : "<end of output>\n");
+            fprintf(stderr, "%s:%u: actual:   %s", expected_path, line, a ? actual_line : "<end of output>\n");
+            same = false;
+        }
+    }
+    fclose(expected);
+    return same;
+}
+
+static void sim_usage(const char *name) {
+    fprintf(stderr, "usage: %s [-q] [-o <output>] [-e <expected>] [<trace>...]\n", name);
+    fprintf(stderr, "  -q             only count events, don't record them\n");
+    fprintf(stderr, "  -o <output>    write recorded events to <output> instead of stdout\n");
+    fprintf(stderr, "  -e <expected>  compare recorded events with <expected>\n");
+#ifdef SIMULATOR_TRACE
+    fprintf(stderr, "Without a trace, %s is checked against %s.\n", SIMULATOR_TRACE, SIMULATOR_EXPECTED);
+#endif
+}
+
+int main(int argc, char **argv) {
+    const char *output_path   = NULL;
+    const char *expected_path = NULL;
+    bool        quiet         = false;
+    int         option;
+
+    while ((option = getopt(argc, argv, "qo:e:h")) != -1) {
+        switch (option) {
+            case 'q':
+                quiet = true;
+                break;
+            case 'o':
+                output_path = optarg;
+                break;
+            case 'e':
+                expected_path = optarg;
+                break;
+            default:
+                sim_usage(argv[0]);
+                return option == 'h' ? 0 : 2;
+        }
+    }
+
+    const char **traces      = (const char **)&argv[optind];
+    int          trace_count = argc - optind;
+    if (trace_count == 0) {
+#ifdef SIMULATOR_TRACE
+        static const char *default_trace[] = {SIMULATOR_TRACE};
+        traces                             = default_trace;
+        trace_count                        = 1;
+        if (!expected_path) {
+            expected_path = SIMULATOR_EXPECTED;
+        }
+#else
+        sim_usage(argv[0]);
+        return 2;
+#endif
+    }
+
+    if (expected_path) {
+        sim_output = tmpfile();
+    } else if (output_path) {
+        sim_output = fopen(output_path, "w");
+    } else if (!quiet) {
+        sim_output = stdout;
+    }
+    if ((expected_path || output_path) && !sim_output) {
+        fprintf(stderr, "simulator: can't open output\n");
+        return 2;
+    }
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    sim_init();
+    for (int i = 0; i < trace_count; i++) {
+        if (!sim_trace_run(traces[i])) {
+            return 2;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    fprintf(stderr, "simulator: %u events, %u scans, %u reports in %.3fs (%.0f scans/s)\n", (unsigned)sim_stats.events, (unsigned)sim_stats.scans, (unsigned)sim_stats.reports, elapsed, elapsed > 0 ? sim_stats.scans / elapsed : 0);
+
+    int result = 0;
+    if (expected_path) {
+        result = sim_compare(sim_output, expected_path) ? 0 : 1;
+    }
+    if (sim_output && sim_output != stdout) {
+        fclose(sim_output);
+    }
+    return result;
+}
@@ -0,0 +1,57 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @file simulator.h
+ *
+ * @brief Host side firmware simulator.
+ *
+ * The simulator links quantum/ against platforms/test like the unit tests do,
+ * but replaces the mocked host with virtual peripherals:
+ *
+ *  - a virtual matrix that trace files press and release keys on,
+ *  - the virtual timer of platforms/test, advanced by one millisecond per scan,
+ *  - a virtual USB host that records every HID report it receives,
+ *  - virtual indicator LEDs, and RGB/LED matrix framebuffers for keymaps that
+ *    enable them with the `custom` driver.
+ *
+ * Everything the host and the LEDs receive is written to the output as one
+ * line per event, prefixed with the virtual time in milliseconds.
+ */
+
+/** Where recorded events are written, NULL to only count them. */
+extern FILE *sim_output;
+
+typedef struct {
+    uint32_t events;  // matrix transitions applied from the trace
+    uint32_t scans;   // keyboard_task() iterations
+    uint32_t reports; // reports received by the virtual host
+} sim_stats_t;
+
+extern sim_stats_t sim_stats;
+
+/* Virtual matrix */
+void sim_matrix_press(uint8_t row, uint8_t col);
+void sim_matrix_release(uint8_t row, uint8_t col);
+void sim_matrix_clear(void);
+
+/* Virtual timer and main loop */
+void     sim_init(void);
+void     sim_scan(uint32_t count);
+uint32_t sim_time(void);
+
+/* Virtual USB host */
+void sim_host_init(void);
+void sim_host_set_leds(uint8_t leds);
+
+/* Virtual LEDs and framebuffers */
+void sim_leds_dump(void);
+
+/* Trace files */
+bool sim_trace_run(const char *path);
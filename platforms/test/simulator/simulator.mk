@@ -0,0 +1,30 @@
+# Builds a test directory as a simulator instead of a gtest suite, selected with
+# `SIMULATOR = yes` in its test.mk. The directory holds a keymap.c and config.h
+# like a keymap does, and optionally a trace.txt with its expected.txt which the
+# simulator checks when it is run without arguments.
+
+SIMULATOR_PATH := $(PLATFORM_PATH)/$(PLATFORM_KEY)/simulator
+
+$(TEST)_SRC := \
+	$(TMK_COMMON_SRC) \
+	$(QUANTUM_SRC) \
+	$(SRC) \
+	$(SIMULATOR_PATH)/simulator.c \
+	$(SIMULATOR_PATH)/sim_host.c \
+	$(SIMULATOR_PATH)/sim_leds.c \
+	$(SIMULATOR_PATH)/sim_matrix.c \
+	$(SIMULATOR_PATH)/sim_trace.c \
+	$(SIMULATOR_PATH)/sim_trace_parse.c \
+	$(patsubst $(ROOTDIR)/%,%,$(wildcard $(TEST_PATH)/*.c))
+
+$(TEST)_DEFS := $(TMK_COMMON_DEFS) $(OPT_DEFS)
+
+ifneq ($(wildcard $(TEST_PATH)/trace.txt),)
+    $(TEST)_DEFS += \
+        -DSIMULATOR_TRACE=\"$(abspath $(TEST_PATH)/trace.txt)\" \
+        -DSIMULATOR_EXPECTED=\"$(abspath $(TEST_PATH)/expected.txt)\"
+endif
+
+$(TEST)_CONFIG := $(TEST_PATH)/config.h
+
+VPATH += $(SIMULATOR_PATH)
@@ -90,6 +90,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#ifdef WEAR_LEVELING_ENABLE
+#    include "wear_leveling.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -317,6 +320,10 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+#ifdef WEAR_LEVELING_ENABLE
+    wear_leveling_task();
+#endif
+
     housekeeping_task_kb();
     housekeeping_task_user();
 }
@@ -349,6 +356,12 @@ void quantum_init(void) {
 #if defined(BLUETOOTH_ENABLE) && defined(OUTPUT_AUTO_ENABLE)
     set_output(OUTPUT_AUTO);
 #endif
+#ifdef PROCESS_RECORD_DISPATCH_SIZE
+    process_record_dispatch_init();
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    key_override_init();
+#endif
 }
 
 /** \brief keyboard_init
@@ -490,7 +503,11 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_MATRIX_EVENTS)
+                    split_matrix_event_time(&event);
+#endif
+                    action_exec(event);
                 }
 
                 switch_events(row, col, key_pressed);
@@ -553,6 +570,10 @@ void quantum_task(void) {
     combo_task();
 #endif
 
+#ifdef LEADER_ENABLE
+    leader_task();
+#endif
+
 #ifdef WPM_ENABLE
     decay_wpm();
 #endif
@@ -576,6 +597,10 @@ void quantum_task(void) {
 #ifdef SECURE_ENABLE
     secure_task();
 #endif
+
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC)
+    send_string_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
@@ -42,6 +42,92 @@ action_t action_for_key(uint8_t layer, keypos_t key) {
     return action_for_keycode(keycode);
 };
 
+/* Keycodes are resolved to actions with at most two table lookups: the high
+ * byte selects how the whole page of 256 keycodes maps to actions, and for the
+ * basic page the low byte selects it for the individual keycode.
+ */
+typedef enum {
+    KEYCODE_ACTION_NO = 0,
+    KEYCODE_ACTION_BASIC_PAGE,
+    KEYCODE_ACTION_KEY,
+    KEYCODE_ACTION_SYSTEM,
+    KEYCODE_ACTION_CONSUMER,
+    KEYCODE_ACTION_MOUSEKEY,
+    KEYCODE_ACTION_TRANSPARENT,
+    KEYCODE_ACTION_MODS,
+    KEYCODE_ACTION_LAYER_TAP,
+    KEYCODE_ACTION_TO,
+    KEYCODE_ACTION_MOMENTARY,
+    KEYCODE_ACTION_DEF_LAYER,
+    KEYCODE_ACTION_TOGGLE_LAYER,
+    KEYCODE_ACTION_ONE_SHOT_LAYER,
+    KEYCODE_ACTION_ONE_SHOT_MOD,
+    KEYCODE_ACTION_LAYER_TAP_TOGGLE,
+    KEYCODE_ACTION_LAYER_MOD,
+    KEYCODE_ACTION_MOD_TAP,
+    KEYCODE_ACTION_SWAP_HANDS,
+} keycode_action_kind_t;
+
+#define KEYCODE_PAGE(keycode) ((keycode) >> 8)
+#define KEYCODE_PAGES(first, last) [KEYCODE_PAGE(first) ... KEYCODE_PAGE(last)]
+#define ASSERT_WHOLE_PAGES(first, last) _Static_assert(((first)&0xFF) == 0 && ((last)&0xFF) == 0xFF, #first " to " #last " must cover whole pages")
+
+ASSERT_WHOLE_PAGES(QK_MODS, QK_MODS_MAX);
+ASSERT_WHOLE_PAGES(QK_LAYER_TAP, QK_LAYER_TAP_MAX);
+ASSERT_WHOLE_PAGES(QK_TO, QK_TO_MAX);
+ASSERT_WHOLE_PAGES(QK_MOMENTARY, QK_MOMENTARY_MAX);
+ASSERT_WHOLE_PAGES(QK_DEF_LAYER, QK_DEF_LAYER_MAX);
+ASSERT_WHOLE_PAGES(QK_TOGGLE_LAYER, QK_TOGGLE_LAYER_MAX);
+ASSERT_WHOLE_PAGES(QK_ONE_SHOT_LAYER, QK_ONE_SHOT_LAYER_MAX);
+ASSERT_WHOLE_PAGES(QK_ONE_SHOT_MOD, QK_ONE_SHOT_MOD_MAX);
+ASSERT_WHOLE_PAGES(QK_SWAP_HANDS, QK_SWAP_HANDS_MAX);
+ASSERT_WHOLE_PAGES(QK_LAYER_TAP_TOGGLE, QK_LAYER_TAP_TOGGLE_MAX);
+ASSERT_WHOLE_PAGES(QK_LAYER_MOD, QK_LAYER_MOD_MAX);
+ASSERT_WHOLE_PAGES(QK_MOD_TAP, QK_MOD_TAP_MAX);
+
+// clang-format off
+
+static const uint8_t keycode_page_actions[256] PROGMEM = {
+    [KEYCODE_PAGE(QK_BASIC)]                                    = KEYCODE_ACTION_BASIC_PAGE,
+    KEYCODE_PAGES(QK_MODS, QK_MODS_MAX)                         = KEYCODE_ACTION_MODS,
+#ifndef NO_ACTION_LAYER
+    KEYCODE_PAGES(QK_LAYER_TAP, QK_LAYER_TAP_MAX)               = KEYCODE_ACTION_LAYER_TAP,
+    KEYCODE_PAGES(QK_TO, QK_TO_MAX)                             = KEYCODE_ACTION_TO,
+    KEYCODE_PAGES(QK_MOMENTARY, QK_MOMENTARY_MAX)               = KEYCODE_ACTION_MOMENTARY,
+    KEYCODE_PAGES(QK_DEF_LAYER, QK_DEF_LAYER_MAX)               = KEYCODE_ACTION_DEF_LAYER,
+    KEYCODE_PAGES(QK_TOGGLE_LAYER, QK_TOGGLE_LAYER_MAX)         = KEYCODE_ACTION_TOGGLE_LAYER,
+#endif
+#ifndef NO_ACTION_ONESHOT
+    KEYCODE_PAGES(QK_ONE_SHOT_LAYER, QK_ONE_SHOT_LAYER_MAX)     = KEYCODE_ACTION_ONE_SHOT_LAYER,
+    KEYCODE_PAGES(QK_ONE_SHOT_MOD, QK_ONE_SHOT_MOD_MAX)         = KEYCODE_ACTION_ONE_SHOT_MOD,
+#endif
+#ifndef NO_ACTION_LAYER
+    KEYCODE_PAGES(QK_LAYER_TAP_TOGGLE, QK_LAYER_TAP_TOGGLE_MAX) = KEYCODE_ACTION_LAYER_TAP_TOGGLE,
+    KEYCODE_PAGES(QK_LAYER_MOD, QK_LAYER_MOD_MAX)               = KEYCODE_ACTION_LAYER_MOD,
+#endif
+#ifndef NO_ACTION_TAPPING
+    KEYCODE_PAGES(QK_MOD_TAP, QK_MOD_TAP_MAX)                   = KEYCODE_ACTION_MOD_TAP,
+#endif
+#ifdef SWAP_HANDS_ENABLE
+    KEYCODE_PAGES(QK_SWAP_HANDS, QK_SWAP_HANDS_MAX)             = KEYCODE_ACTION_SWAP_HANDS,
+#endif
+};
+
+static const uint8_t keycode_basic_actions[256] PROGMEM = {
+    [KC_TRANSPARENT]                       = KEYCODE_ACTION_TRANSPARENT,
+    [KC_A ... KC_EXSEL]                    = KEYCODE_ACTION_KEY,
+    [KC_LEFT_CTRL ... KC_RIGHT_GUI]        = KEYCODE_ACTION_KEY,
+#ifdef EXTRAKEY_ENABLE
+    [KC_SYSTEM_POWER ... KC_SYSTEM_WAKE]   = KEYCODE_ACTION_SYSTEM,
+    [KC_AUDIO_MUTE ... KC_BRIGHTNESS_DOWN] = KEYCODE_ACTION_CONSUMER,
+#endif
+#ifdef MOUSEKEY_ENABLE
+    [KC_MS_UP ... KC_MS_ACCEL2]            = KEYCODE_ACTION_MOUSEKEY,
+#endif
+};
+
+// clang-format on
+
 action_t action_for_keycode(uint16_t keycode) {
     // keycode remapping
     keycode = keycode_config(keycode);
@@ -52,87 +138,91 @@ action_t action_for_keycode(uint16_t keycode) {
     (void)action_layer;
     (void)mod;
 
-    switch (keycode) {
-        case KC_A ... KC_EXSEL:
-        case KC_LEFT_CTRL ... KC_RIGHT_GUI:
+    uint8_t kind = pgm_read_byte(&keycode_page_actions[KEYCODE_PAGE(keycode)]);
+    if (kind == KEYCODE_ACTION_BASIC_PAGE) {
+        kind = pgm_read_byte(&keycode_basic_actions[keycode & 0xFF]);
+    }
+
+    switch (kind) {
+        case KEYCODE_ACTION_KEY:
             action.code = ACTION_KEY(keycode);
             break;
 #ifdef EXTRAKEY_ENABLE
-        case KC_SYSTEM_POWER ... KC_SYSTEM_WAKE:
+        case KEYCODE_ACTION_SYSTEM:
             action.code = ACTION_USAGE_SYSTEM(KEYCODE2SYSTEM(keycode));
             break;
-        case KC_AUDIO_MUTE ... KC_BRIGHTNESS_DOWN:
+        case KEYCODE_ACTION_CONSUMER:
             action.code = ACTION_USAGE_CONSUMER(KEYCODE2CONSUMER(keycode));
             break;
 #endif
 #ifdef MOUSEKEY_ENABLE
-        case KC_MS_UP ... KC_MS_ACCEL2:
+        case KEYCODE_ACTION_MOUSEKEY:
             action.code = ACTION_MOUSEKEY(keycode);
             break;
 #endif
-        case KC_TRANSPARENT:
+        case KEYCODE_ACTION_TRANSPARENT:
             action.code = ACTION_TRANSPARENT;
             break;
-        case QK_MODS ... QK_MODS_MAX:;
+        case KEYCODE_ACTION_MODS:
             // Has a modifier
             // Split it up
             action.code = ACTION_MODS_KEY(keycode >> 8, keycode & 0xFF); // adds modifier to key
             break;
 #ifndef NO_ACTION_LAYER
-        case QK_LAYER_TAP ... QK_LAYER_TAP_MAX:
+        case KEYCODE_ACTION_LAYER_TAP:
             action.code = ACTION_LAYER_TAP_KEY((keycode >> 0x8) & 0xF, keycode & 0xFF);
             break;
-        case QK_TO ... QK_TO_MAX:;
+        case KEYCODE_ACTION_TO:
             // Layer set "GOTO"
             action_layer = keycode & 0xFF;
             action.code  = ACTION_LAYER_GOTO(action_layer);
             break;
-        case QK_MOMENTARY ... QK_MOMENTARY_MAX:;
+        case KEYCODE_ACTION_MOMENTARY:
             // Momentary action_layer
             action_layer = keycode & 0xFF;
             action.code  = ACTION_LAYER_MOMENTARY(action_layer);
             break;
-        case QK_DEF_LAYER ... QK_DEF_LAYER_MAX:;
+        case KEYCODE_ACTION_DEF_LAYER:
             // Set default action_layer
             action_layer = keycode & 0xFF;
             action.code  = ACTION_DEFAULT_LAYER_SET(action_layer);
             break;
-        case QK_TOGGLE_LAYER ... QK_TOGGLE_LAYER_MAX:;
+        case KEYCODE_ACTION_TOGGLE_LAYER:
             // Set toggle
             action_layer = keycode & 0xFF;
             action.code  = ACTION_LAYER_TOGGLE(action_layer);
             break;
 #endif
 #ifndef NO_ACTION_ONESHOT
-        case QK_ONE_SHOT_LAYER ... QK_ONE_SHOT_LAYER_MAX:;
+        case KEYCODE_ACTION_ONE_SHOT_LAYER:
             // OSL(action_layer) - One-shot action_layer
             action_layer = keycode & 0xFF;
             action.code  = ACTION_LAYER_ONESHOT(action_layer);
             break;
-        case QK_ONE_SHOT_MOD ... QK_ONE_SHOT_MOD_MAX:;
+        case KEYCODE_ACTION_ONE_SHOT_MOD:
             // OSM(mod) - One-shot mod
             mod         = mod_config(keycode & 0xFF);
             action.code = ACTION_MODS_ONESHOT(mod);
             break;
 #endif
 #ifndef NO_ACTION_LAYER
-        case QK_LAYER_TAP_TOGGLE ... QK_LAYER_TAP_TOGGLE_MAX:
+        case KEYCODE_ACTION_LAYER_TAP_TOGGLE:
             action.code = ACTION_LAYER_TAP_TOGGLE(keycode & 0xFF);
             break;
-        case QK_LAYER_MOD ... QK_LAYER_MOD_MAX:
+        case KEYCODE_ACTION_LAYER_MOD:
             mod          = mod_config(keycode & 0xF);
             action_layer = (keycode >> 4) & 0xF;
             action.code  = ACTION_LAYER_MODS(action_layer, mod);
             break;
 #endif
 #ifndef NO_ACTION_TAPPING
-        case QK_MOD_TAP ... QK_MOD_TAP_MAX:
+        case KEYCODE_ACTION_MOD_TAP:
             mod         = mod_config((keycode >> 0x8) & 0x1F);
             action.code = ACTION_MODS_TAP_KEY(mod, keycode & 0xFF);
             break;
 #endif
 #ifdef SWAP_HANDS_ENABLE
-        case QK_SWAP_HANDS ... QK_SWAP_HANDS_MAX:
+        case KEYCODE_ACTION_SWAP_HANDS:
             action.code = ACTION(ACT_SWAP_HANDS, keycode & 0xff);
             break;
 #endif
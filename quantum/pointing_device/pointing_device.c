@@ -50,6 +50,65 @@ void pointing_device_set_shared_report(report_mouse_t new_mouse_report) {
     shared_mouse_report = new_mouse_report;
 }
 
+static struct {
+    int32_t x;
+    int32_t y;
+    int16_t h;
+    int16_t v;
+} shared_motion = {0};
+
+/**
+ * @brief Adds motion received from the other half to the shared mouse report
+ *
+ * Motion is accumulated until the pointing device task next runs, and whatever doesn't fit in a single report is carried over to the following one.
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE
+ *
+ * @param[in] x int16_t
+ * @param[in] y int16_t
+ * @param[in] h int16_t
+ * @param[in] v int16_t
+ * @param[in] buttons uint8_t current button state
+ */
+void pointing_device_add_shared_motion(int16_t x, int16_t y, int16_t h, int16_t v, uint8_t buttons) {
+    shared_motion.x += x;
+    shared_motion.y += y;
+    shared_motion.h += h;
+    shared_motion.v += v;
+    shared_mouse_report.buttons = buttons;
+}
+
+/**
+ * @brief Moves as much of the accumulated shared motion into the shared mouse report as it can hold
+ *
+ * @param[in] total int32_t motion already in the report plus the accumulated motion
+ * @param[in] limit int32_t largest magnitude the report can hold
+ * @return int32_t clamped motion
+ */
+static int32_t pointing_device_take_shared_axis(int32_t total, int32_t limit) {
+    if (total > limit) {
+        return limit;
+    } else if (total < -limit) {
+        return -limit;
+    }
+    return total;
+}
+
+static void pointing_device_take_shared_motion(void) {
+    int32_t x = pointing_device_take_shared_axis(shared_mouse_report.x + shared_motion.x, XY_REPORT_MAX);
+    int32_t y = pointing_device_take_shared_axis(shared_mouse_report.y + shared_motion.y, XY_REPORT_MAX);
+    int32_t h = pointing_device_take_shared_axis(shared_mouse_report.h + shared_motion.h, INT8_MAX);
+    int32_t v = pointing_device_take_shared_axis(shared_mouse_report.v + shared_motion.v, INT8_MAX);
+    shared_motion.x -= x - shared_mouse_report.x;
+    shared_motion.y -= y - shared_mouse_report.y;
+    shared_motion.h -= h - shared_mouse_report.h;
+    shared_motion.v -= v - shared_mouse_report.v;
+    shared_mouse_report.x = x;
+    shared_mouse_report.y = y;
+    shared_mouse_report.h = h;
+    shared_mouse_report.v = v;
+}
+
 /**
  * @brief Gets current pointing device CPI if supported
  *
@@ -75,8 +134,56 @@ uint16_t pointing_device_get_shared_cpi(void) {
 
 static report_mouse_t local_mouse_report = {};
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+static pointing_device_accel_context_t accel_left  = {};
+static pointing_device_accel_context_t accel_right = {};
+#    else
+static pointing_device_accel_context_t accel = {};
+#    endif
+#endif
+
 extern const pointing_device_driver_t pointing_device_driver;
 
+/**
+ * @brief Gets the motion from the pointing device driver
+ *
+ * When sampling from a separate thread, this collects the motion accumulated by that thread instead.
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t
+ */
+static inline report_mouse_t pointing_device_read_driver(report_mouse_t mouse_report) {
+#ifdef POINTING_DEVICE_SAMPLE_INTERVAL_US
+    return pointing_device_pipeline_get_report(mouse_report);
+#else
+    return pointing_device_driver.get_report(mouse_report);
+#endif
+}
+
+/**
+ * @brief Gets the pointing device driver CPI, without racing the sampling thread
+ *
+ * @return cpi value as uint16_t
+ */
+static uint16_t pointing_device_read_cpi(void) {
+    pointing_device_pipeline_lock();
+    uint16_t cpi = pointing_device_driver.get_cpi();
+    pointing_device_pipeline_unlock();
+    return cpi;
+}
+
+/**
+ * @brief Sets the pointing device driver CPI, without racing the sampling thread
+ *
+ * @param[in] cpi uint16_t value.
+ */
+static void pointing_device_write_cpi(uint16_t cpi) {
+    pointing_device_pipeline_lock();
+    pointing_device_driver.set_cpi(cpi);
+    pointing_device_pipeline_unlock();
+}
+
 /**
  * @brief Keyboard level code pointing device initialisation
  *
@@ -145,9 +252,21 @@ __attribute__((weak)) void pointing_device_init(void) {
         pointing_device_driver.init();
 #ifdef POINTING_DEVICE_MOTION_PIN
         setPinInputHigh(POINTING_DEVICE_MOTION_PIN);
+#endif
+#ifdef POINTING_DEVICE_SAMPLE_INTERVAL_US
+        pointing_device_pipeline_init();
 #endif
     }
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+    pointing_device_accel_init(&accel_left);
+    pointing_device_accel_init(&accel_right);
+#    else
+    pointing_device_accel_init(&accel);
+#    endif
+#endif
+
     pointing_device_init_kb();
     pointing_device_init_user();
 }
@@ -233,8 +352,15 @@ __attribute__((weak)) void pointing_device_task(void) {
     last_exec = timer_read32();
 #endif
 
+#ifdef POINTING_DEVICE_SAMPLE_INTERVAL_US
+    // Leave the motion with the sampling thread until the previous report has been sent
+    if (!pointing_device_pipeline_ready()) {
+        return;
+    }
+#endif
+
     // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
+#if defined(POINTING_DEVICE_MOTION_PIN) && !defined(POINTING_DEVICE_SAMPLE_INTERVAL_US)
 #    if defined(SPLIT_POINTING_ENABLE)
 #        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
 #    endif
@@ -242,18 +368,19 @@ __attribute__((weak)) void pointing_device_task(void) {
 #endif
 
 #if defined(SPLIT_POINTING_ENABLE)
+        pointing_device_take_shared_motion();
 #    if defined(POINTING_DEVICE_COMBINED)
-        static uint8_t old_buttons = 0;
+    static uint8_t old_buttons = 0;
     local_mouse_report.buttons = old_buttons;
-    local_mouse_report         = pointing_device_driver.get_report(local_mouse_report);
+    local_mouse_report         = pointing_device_read_driver(local_mouse_report);
     old_buttons                = local_mouse_report.buttons;
 #    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
-        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver.get_report(local_mouse_report) : shared_mouse_report;
+    local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_read_driver(local_mouse_report) : shared_mouse_report;
 #    else
 #        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
 #    endif
 #else
-    local_mouse_report = pointing_device_driver.get_report(local_mouse_report);
+    local_mouse_report = pointing_device_read_driver(local_mouse_report);
 #endif // defined(SPLIT_POINTING_ENABLE)
 
     // allow kb to intercept and modify report
@@ -261,13 +388,24 @@ __attribute__((weak)) void pointing_device_task(void) {
     if (is_keyboard_left()) {
         local_mouse_report  = pointing_device_adjust_by_defines(local_mouse_report);
         shared_mouse_report = pointing_device_adjust_by_defines_right(shared_mouse_report);
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+        local_mouse_report  = pointing_device_accel_apply(&accel_left, local_mouse_report);
+        shared_mouse_report = pointing_device_accel_apply(&accel_right, shared_mouse_report);
+#    endif
     } else {
         local_mouse_report  = pointing_device_adjust_by_defines_right(local_mouse_report);
         shared_mouse_report = pointing_device_adjust_by_defines(shared_mouse_report);
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+        local_mouse_report  = pointing_device_accel_apply(&accel_right, local_mouse_report);
+        shared_mouse_report = pointing_device_accel_apply(&accel_left, shared_mouse_report);
+#    endif
     }
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
 #else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+    local_mouse_report = pointing_device_accel_apply(&accel, local_mouse_report);
+#    endif
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
 #endif
     // combine with mouse report to ensure that the combined is sent correctly
@@ -276,6 +414,13 @@ __attribute__((weak)) void pointing_device_task(void) {
     local_mouse_report.buttons     = local_mouse_report.buttons | mousekey_report.buttons;
 #endif
     pointing_device_send();
+#if defined(SPLIT_POINTING_ENABLE)
+    // The shared motion has been sent, only the buttons stay
+    shared_mouse_report.x = 0;
+    shared_mouse_report.y = 0;
+    shared_mouse_report.h = 0;
+    shared_mouse_report.v = 0;
+#endif
 }
 
 /**
@@ -305,9 +450,9 @@ void pointing_device_set_report(report_mouse_t mouse_report) {
  */
 uint16_t pointing_device_get_cpi(void) {
 #if defined(SPLIT_POINTING_ENABLE)
-    return POINTING_DEVICE_THIS_SIDE ? pointing_device_driver.get_cpi() : shared_cpi;
+    return POINTING_DEVICE_THIS_SIDE ? pointing_device_read_cpi() : shared_cpi;
 #else
-    return pointing_device_driver.get_cpi();
+    return pointing_device_read_cpi();
 #endif
 }
 
@@ -321,15 +466,51 @@ uint16_t pointing_device_get_cpi(void) {
 void pointing_device_set_cpi(uint16_t cpi) {
 #if defined(SPLIT_POINTING_ENABLE)
     if (POINTING_DEVICE_THIS_SIDE) {
-        pointing_device_driver.set_cpi(cpi);
+        pointing_device_write_cpi(cpi);
     } else {
         shared_cpi = cpi;
     }
 #else
-    pointing_device_driver.set_cpi(cpi);
+    pointing_device_write_cpi(cpi);
 #endif
 }
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+/**
+ * @brief Gets the acceleration curve and smoothing applied to the pointing device
+ *
+ * NOTE: With POINTING_DEVICE_COMBINED, this returns the configuration of the left side
+ *
+ * @return pointing_device_accel_config_t
+ */
+pointing_device_accel_config_t pointing_device_get_accel_config(void) {
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+    return accel_left.config;
+#    else
+    return accel.config;
+#    endif
+}
+
+/**
+ * @brief Sets the acceleration curve and smoothing applied to the pointing device
+ *
+ * Takes a pointing_device_accel_config_t, whose curve must be stored in PROGMEM. With POINTING_DEVICE_COMBINED, this applies to both sides.
+ *
+ * @param[in] config pointing_device_accel_config_t
+ */
+void pointing_device_set_accel_config(pointing_device_accel_config_t config) {
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+    accel_left.config  = config;
+    accel_right.config = config;
+    pointing_device_accel_reset(&accel_left);
+    pointing_device_accel_reset(&accel_right);
+#    else
+    accel.config = config;
+    pointing_device_accel_reset(&accel);
+#    endif
+}
+#endif
+
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
 /**
  * @brief Set pointing device CPI if supported
@@ -344,12 +525,28 @@ void pointing_device_set_cpi(uint16_t cpi) {
 void pointing_device_set_cpi_on_side(bool left, uint16_t cpi) {
     bool local = (is_keyboard_left() & left) ? true : false;
     if (local) {
-        pointing_device_driver.set_cpi(cpi);
+        pointing_device_write_cpi(cpi);
     } else {
         shared_cpi = cpi;
     }
 }
 
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+/**
+ * @brief Sets the acceleration curve and smoothing applied to one side's pointing device
+ *
+ * NOTE: Only available when using SPLIT_POINTING_ENABLE and POINTING_DEVICE_COMBINED
+ *
+ * @param[in] left true = left, false = right.
+ * @param[in] config pointing_device_accel_config_t, whose curve must be stored in PROGMEM.
+ */
+void pointing_device_set_accel_config_on_side(bool left, pointing_device_accel_config_t config) {
+    pointing_device_accel_context_t *side = left ? &accel_left : &accel_right;
+    side->config                          = config;
+    pointing_device_accel_reset(side);
+}
+#    endif
+
 /**
  * @brief clamps int16_t to int8_t
  *
@@ -20,6 +20,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <stdint.h>
 #include "host.h"
 #include "report.h"
+#include "pointing_device_pipeline.h"
+#include "pointing_device_accel.h"
 
 #if defined(POINTING_DEVICE_DRIVER_adns5050)
 #    include "drivers/sensors/adns5050.h"
@@ -101,14 +103,23 @@ report_mouse_t pointing_device_task_user(report_mouse_t mouse_report);
 uint8_t        pointing_device_handle_buttons(uint8_t buttons, bool pressed, pointing_device_buttons_t button);
 report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report);
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+pointing_device_accel_config_t pointing_device_get_accel_config(void);
+void                           pointing_device_set_accel_config(pointing_device_accel_config_t config);
+#endif
+
 #if defined(SPLIT_POINTING_ENABLE)
 void     pointing_device_set_shared_report(report_mouse_t report);
+void     pointing_device_add_shared_motion(int16_t x, int16_t y, int16_t h, int16_t v, uint8_t buttons);
 uint16_t pointing_device_get_shared_cpi(void);
 #    if !defined(POINTING_DEVICE_TASK_THROTTLE_MS)
 #        define POINTING_DEVICE_TASK_THROTTLE_MS 1
 #    endif
 #    if defined(POINTING_DEVICE_COMBINED)
 void           pointing_device_set_cpi_on_side(bool left, uint16_t cpi);
+#        ifdef POINTING_DEVICE_ACCEL_ENABLE
+void pointing_device_set_accel_config_on_side(bool left, pointing_device_accel_config_t config);
+#        endif
 report_mouse_t pointing_device_combine_reports(report_mouse_t left_report, report_mouse_t right_report);
 report_mouse_t pointing_device_task_combined_kb(report_mouse_t left_report, report_mouse_t right_report);
 report_mouse_t pointing_device_task_combined_user(report_mouse_t left_report, report_mouse_t right_report);
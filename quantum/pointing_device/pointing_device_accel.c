@@ -0,0 +1,134 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "pointing_device_accel.h"
+#include "pointing_device.h"
+#include "progmem.h"
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+
+/*
+ * Each report is first run through an exponential moving average, whose
+ * sample weight rises with speed so that slow movements are steadied while
+ * fast ones keep up (the idea behind the one euro filter). The smoothed
+ * motion is then multiplied by a gain looked up on a piecewise linear curve.
+ * Everything is fixed point with 8 fractional bits, and whatever does not
+ * add up to a whole count is carried over to the next report.
+ *
+ * Motion and carry are limited to POINTING_DEVICE_ACCEL_MOTION_MAX counts,
+ * so that every product fits in 32 bits. 64 bit divisions are a library
+ * call on AVR and Cortex-M0.
+ */
+
+static const pointing_device_accel_point_t default_curve[] PROGMEM = POINTING_DEVICE_ACCEL_CURVE;
+
+void pointing_device_accel_init(pointing_device_accel_context_t *accel) {
+    accel->config.curve        = default_curve;
+    accel->config.curve_length = sizeof(default_curve) / sizeof(default_curve[0]);
+    accel->config.min_alpha    = POINTING_DEVICE_SMOOTHING_MIN_ALPHA;
+    accel->config.beta         = POINTING_DEVICE_SMOOTHING_BETA;
+    pointing_device_accel_reset(accel);
+}
+
+void pointing_device_accel_reset(pointing_device_accel_context_t *accel) {
+    memset(&accel->status, 0, sizeof(accel->status));
+}
+
+uint16_t pointing_device_accel_gain(const pointing_device_accel_config_t *config, uint16_t speed) {
+    if (config->curve_length == 0) {
+        return 256;
+    }
+
+    uint16_t prev_speed = pgm_read_word(&config->curve[0].speed);
+    uint16_t prev_gain  = pgm_read_word(&config->curve[0].gain);
+    if (speed <= prev_speed) {
+        return prev_gain;
+    }
+
+    for (uint8_t i = 1; i < config->curve_length; i++) {
+        uint16_t next_speed = pgm_read_word(&config->curve[i].speed);
+        uint16_t next_gain  = pgm_read_word(&config->curve[i].gain);
+        if (speed < next_speed) {
+            return prev_gain + ((int32_t)next_gain - prev_gain) * (speed - prev_speed) / (next_speed - prev_speed);
+        }
+        prev_speed = next_speed;
+        prev_gain  = next_gain;
+    }
+
+    return prev_gain;
+}
+
+static int32_t pointing_device_accel_clamp(int32_t value, int32_t limit) {
+    return value > limit ? limit : value < -limit ? -limit : value;
+}
+
+/**
+ * @brief Multiplies a fixed point value by factor / 256, rounded to nearest
+ *
+ * The whole counts and the fraction are scaled separately, so nothing
+ * overflows as long as value / 256 * factor fits in an int32_t.
+ */
+static int32_t pointing_device_accel_scale(int32_t value, uint16_t factor) {
+    int32_t whole    = value >> 8;
+    int32_t fraction = value & 0xFF;
+    return whole * factor + ((fraction * factor + 128) >> 8);
+}
+
+/**
+ * @brief Approximates the length of a vector, to within 12%
+ */
+static uint32_t pointing_device_accel_magnitude(int32_t x, int32_t y) {
+    uint32_t a = x < 0 ? -x : x;
+    uint32_t b = y < 0 ? -y : y;
+    return a > b ? a + b / 2 : b + a / 2;
+}
+
+/**
+ * @brief Moves the smoothed value towards the new sample by alpha / 256 of the difference
+ *
+ * Always moves by at least 1/256 of a count, so the average settles on the
+ * sample instead of getting stuck just short of it.
+ */
+static void pointing_device_accel_smooth(int32_t *smoothed, int32_t sample, uint16_t alpha) {
+    int32_t difference = sample - *smoothed;
+    int32_t step       = pointing_device_accel_scale(difference, alpha);
+    if (step == 0) {
+        step = difference;
+    }
+    *smoothed += step;
+}
+
+/**
+ * @brief Applies the gain and takes out the whole counts that fit in a report
+ *
+ * Counts beyond the report range are carried over too, up to POINTING_DEVICE_ACCEL_MOTION_MAX.
+ */
+static mouse_xy_report_t pointing_device_accel_take(int32_t smoothed, int32_t *carry, uint16_t gain) {
+    int32_t total  = pointing_device_accel_scale(smoothed, gain) + *carry;
+    int32_t counts = pointing_device_accel_clamp(total / 256, XY_REPORT_MAX);
+    *carry         = pointing_device_accel_clamp(total - counts * 256, POINTING_DEVICE_ACCEL_MOTION_MAX * 256);
+    return counts;
+}
+
+report_mouse_t pointing_device_accel_apply(pointing_device_accel_context_t *accel, report_mouse_t mouse_report) {
+    pointing_device_accel_status_t *status = &accel->status;
+
+    int32_t x = pointing_device_accel_clamp(mouse_report.x, POINTING_DEVICE_ACCEL_MOTION_MAX);
+    int32_t y = pointing_device_accel_clamp(mouse_report.y, POINTING_DEVICE_ACCEL_MOTION_MAX);
+
+    uint32_t alpha = accel->config.min_alpha + (uint32_t)accel->config.beta * pointing_device_accel_magnitude(x, y);
+    if (alpha > 256) {
+        alpha = 256;
+    }
+    pointing_device_accel_smooth(&status->x, x * 256, alpha);
+    pointing_device_accel_smooth(&status->y, y * 256, alpha);
+
+    uint32_t speed = pointing_device_accel_magnitude(status->x, status->y) / 256;
+    uint16_t gain  = pointing_device_accel_gain(&accel->config, speed > UINT16_MAX ? UINT16_MAX : speed);
+
+    mouse_report.x = pointing_device_accel_take(status->x, &status->carry_x, gain);
+    mouse_report.y = pointing_device_accel_take(status->y, &status->carry_y, gain);
+    return mouse_report;
+}
+#endif
@@ -0,0 +1,67 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+/*
+ * Gains and smoothing factors are fixed point, with 256 being 1.0.
+ */
+
+/* Largest motion per report, and largest backlog carried over, in counts */
+#    define POINTING_DEVICE_ACCEL_MOTION_MAX 16383
+
+#    ifndef POINTING_DEVICE_ACCEL_CURVE
+/* Unity gain for slow, precise movement, rising to 4x for fast flicks */
+#        define POINTING_DEVICE_ACCEL_CURVE \
+            { {0, 256}, {2, 256}, {8, 384}, {24, 640}, {64, 1024} }
+#    endif
+#    ifndef POINTING_DEVICE_SMOOTHING_MIN_ALPHA
+/* Weight of a new sample at rest, 256 disables smoothing */
+#        define POINTING_DEVICE_SMOOTHING_MIN_ALPHA 256
+#    endif
+#    ifndef POINTING_DEVICE_SMOOTHING_BETA
+/* Increase of the sample weight per count of speed, 0 is a plain moving average */
+#        define POINTING_DEVICE_SMOOTHING_BETA 0
+#    endif
+
+typedef struct {
+    uint16_t speed; /* Counts per report */
+    uint16_t gain;  /* Gain at this speed, 256 = 1.0 */
+} pointing_device_accel_point_t;
+
+typedef struct {
+    const pointing_device_accel_point_t *curve;        /* PROGMEM points in ascending speed order */
+    uint8_t                              curve_length; /* Number of points, 0 disables acceleration */
+    uint16_t                             min_alpha;    /* Smoothing sample weight at rest, 256 disables smoothing */
+    uint16_t                             beta;         /* Sample weight added per count of speed */
+} pointing_device_accel_config_t;
+
+typedef struct {
+    int32_t x;       /* Smoothed motion, in 1/256 counts */
+    int32_t y;       /* Smoothed motion, in 1/256 counts */
+    int32_t carry_x; /* Fraction of a count left over from the last report, in 1/256 counts */
+    int32_t carry_y; /* Fraction of a count left over from the last report, in 1/256 counts */
+} pointing_device_accel_status_t;
+
+typedef struct {
+    pointing_device_accel_config_t config;
+    pointing_device_accel_status_t status;
+} pointing_device_accel_context_t;
+
+/* Sets up a context with the curve and smoothing from config.h */
+void pointing_device_accel_init(pointing_device_accel_context_t *accel);
+
+/* Looks up the gain for a speed on the curve, interpolating between points */
+uint16_t pointing_device_accel_gain(const pointing_device_accel_config_t *config, uint16_t speed);
+
+/* Smooths and accelerates the motion of a report, carrying fractions of a count over to the next report */
+report_mouse_t pointing_device_accel_apply(pointing_device_accel_context_t *accel, report_mouse_t mouse_report);
+
+/* Drops any smoothed motion and carried fractions */
+void pointing_device_accel_reset(pointing_device_accel_context_t *accel);
+#endif
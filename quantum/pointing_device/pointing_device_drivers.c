@@ -315,8 +315,12 @@ static uint16_t pmw33xx_get_cpi_wrapper(void) {
 }
 
 report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
-    pmw33xx_report_t report    = pmw33xx_read_burst(0);
-    static bool      in_motion = false;
+#    ifdef PMW33XX_MOTION_INTERRUPT
+    pmw33xx_report_t report = pmw33xx_read_accumulated(0, XY_REPORT_MAX);
+#    else
+    pmw33xx_report_t report = pmw33xx_read_burst(0);
+#    endif
+    static bool in_motion = false;
 
     if (report.motion.b.is_lifted) {
         return mouse_report;
@@ -0,0 +1,126 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pointing_device.h"
+
+#ifdef POINTING_DEVICE_SAMPLE_INTERVAL_US
+#    include <ch.h>
+#    include <hal.h>
+#    include "usb_main.h"
+
+/*
+ * The driver is sampled from a high priority thread at a fixed interval, so
+ * the sensor keeps being read while the main loop is busy with something
+ * else. Motion is accumulated in 1/256 counts until the main loop collects
+ * it, which only happens once the previous mouse report has left the
+ * endpoint, so sending never has to wait for the host.
+ */
+typedef struct {
+    int32_t x; // 1/256 counts
+    int32_t y; // 1/256 counts
+    int16_t h;
+    int16_t v;
+    uint8_t buttons;
+    uint8_t buttons_changed;
+} pointing_device_accumulator_t;
+
+extern const pointing_device_driver_t pointing_device_driver;
+
+static pointing_device_accumulator_t accumulator = {0};
+static MUTEX_DECL(driver_mutex);
+
+void pointing_device_pipeline_lock(void) {
+    chMtxLock(&driver_mutex);
+}
+
+void pointing_device_pipeline_unlock(void) {
+    chMtxUnlock(&driver_mutex);
+}
+
+static void pointing_device_pipeline_sample(void) {
+    static report_mouse_t sample = {0};
+
+#    ifdef POINTING_DEVICE_MOTION_PIN
+    if (readPin(POINTING_DEVICE_MOTION_PIN)) {
+        return;
+    }
+#    endif
+
+    uint8_t buttons = sample.buttons;
+    sample.x        = 0;
+    sample.y        = 0;
+    sample.h        = 0;
+    sample.v        = 0;
+
+    pointing_device_pipeline_lock();
+    sample = pointing_device_driver.get_report(sample);
+    pointing_device_pipeline_unlock();
+
+    chSysLock();
+    accumulator.x += (int32_t)sample.x * POINTING_DEVICE_SAMPLE_SCALE;
+    accumulator.y += (int32_t)sample.y * POINTING_DEVICE_SAMPLE_SCALE;
+    accumulator.h += sample.h;
+    accumulator.v += sample.v;
+
+    accumulator.buttons_changed |= buttons ^ sample.buttons;
+    accumulator.buttons = sample.buttons;
+    chSysUnlock();
+}
+
+static THD_WORKING_AREA(pointing_device_pipeline_wa, POINTING_DEVICE_SAMPLE_STACK_SIZE);
+static THD_FUNCTION(pointing_device_pipeline_thread, arg) {
+    (void)arg;
+    chRegSetThreadName("pointing_device");
+
+    systime_t next = chVTGetSystemTimeX();
+    while (true) {
+        next = chThdSleepUntilWindowed(next, chTimeAddX(next, TIME_US2I(POINTING_DEVICE_SAMPLE_INTERVAL_US)));
+        pointing_device_pipeline_sample();
+    }
+}
+
+void pointing_device_pipeline_init(void) {
+    chThdCreateStatic(pointing_device_pipeline_wa, sizeof(pointing_device_pipeline_wa), HIGHPRIO, pointing_device_pipeline_thread, NULL);
+}
+
+bool pointing_device_pipeline_ready(void) {
+    return mouse_endpoint_ready();
+}
+
+/**
+ * @brief Takes the whole counts out of a fixed point accumulator
+ *
+ * At most limit counts are taken, the fraction and anything beyond the limit
+ * remain in the accumulator.
+ */
+static int32_t pointing_device_pipeline_take(int32_t *value, int32_t limit) {
+    int32_t counts = *value / 256;
+    if (counts > limit) {
+        counts = limit;
+    } else if (counts < -limit) {
+        counts = -limit;
+    }
+    *value -= counts * 256;
+    return counts;
+}
+
+static int8_t pointing_device_pipeline_take_hv(int16_t *value) {
+    int8_t counts = *value > INT8_MAX ? INT8_MAX : (*value < -INT8_MAX ? -INT8_MAX : *value);
+    *value -= counts;
+    return counts;
+}
+
+report_mouse_t pointing_device_pipeline_get_report(report_mouse_t mouse_report) {
+    chSysLock();
+    mouse_report.x       = pointing_device_pipeline_take(&accumulator.x, XY_REPORT_MAX);
+    mouse_report.y       = pointing_device_pipeline_take(&accumulator.y, XY_REPORT_MAX);
+    mouse_report.h       = pointing_device_pipeline_take_hv(&accumulator.h);
+    mouse_report.v       = pointing_device_pipeline_take_hv(&accumulator.v);
+    mouse_report.buttons = (mouse_report.buttons & ~accumulator.buttons_changed) | (accumulator.buttons & accumulator.buttons_changed);
+
+    accumulator.buttons_changed = 0;
+    chSysUnlock();
+
+    return mouse_report;
+}
+#endif
@@ -0,0 +1,38 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+#ifdef POINTING_DEVICE_SAMPLE_INTERVAL_US
+#    if !defined(PROTOCOL_CHIBIOS)
+#        error "POINTING_DEVICE_SAMPLE_INTERVAL_US is only supported on ChibiOS"
+#    endif
+/* Sensor deltas are multiplied by POINTING_DEVICE_SAMPLE_SCALE / 256, fractions carry over */
+#    ifndef POINTING_DEVICE_SAMPLE_SCALE
+#        define POINTING_DEVICE_SAMPLE_SCALE 256
+#    endif
+/* The sampling thread runs the driver's get_report(), including any debug output or custom driver code */
+#    ifndef POINTING_DEVICE_SAMPLE_STACK_SIZE
+#        define POINTING_DEVICE_SAMPLE_STACK_SIZE 1024
+#    endif
+
+/* Starts sampling the pointing device driver from its own thread */
+void pointing_device_pipeline_init(void);
+
+/* Takes the motion accumulated since the last call, anything beyond the report range is kept for the next call */
+report_mouse_t pointing_device_pipeline_get_report(report_mouse_t mouse_report);
+
+/* false while the previous mouse report is still waiting to be sent */
+bool pointing_device_pipeline_ready(void);
+
+/* Serialises calls into the pointing device driver with the sampling thread */
+void pointing_device_pipeline_lock(void);
+void pointing_device_pipeline_unlock(void);
+#else
+static inline void pointing_device_pipeline_lock(void) {}
+static inline void pointing_device_pipeline_unlock(void) {}
+#endif
@@ -0,0 +1,162 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+#include <algorithm>
+#include <cstdlib>
+
+class PointingDeviceAccel : public testing::Test {
+   protected:
+    void SetUp() override {
+        pointing_device_accel_init(&accel);
+    }
+
+    /* Flat curve, the same gain at every speed */
+    void set_gain(uint16_t gain) {
+        curve[0]                  = {0, gain};
+        accel.config.curve        = curve;
+        accel.config.curve_length = 1;
+    }
+
+    void set_smoothing(uint16_t min_alpha, uint16_t beta) {
+        accel.config.min_alpha = min_alpha;
+        accel.config.beta      = beta;
+    }
+
+    int32_t move(int32_t x) {
+        report_mouse_t report = {};
+        report.x              = x;
+        return pointing_device_accel_apply(&accel, report).x;
+    }
+
+    /* Sends empty reports until the carried over motion is used up */
+    int32_t drain() {
+        int32_t total = 0;
+        for (int32_t counts; (counts = move(0)) != 0;) {
+            total += counts;
+        }
+        return total;
+    }
+
+    pointing_device_accel_context_t accel;
+    pointing_device_accel_point_t   curve[1];
+};
+
+TEST_F(PointingDeviceAccel, GainIsInterpolated) {
+    /* Default curve: {2, 256}, {8, 384} */
+    EXPECT_EQ(pointing_device_accel_gain(&accel.config, 0), 256);
+    EXPECT_EQ(pointing_device_accel_gain(&accel.config, 5), 320);
+    EXPECT_EQ(pointing_device_accel_gain(&accel.config, UINT16_MAX), 1024);
+}
+
+TEST_F(PointingDeviceAccel, FractionsCarryOver) {
+    set_gain(384);
+
+    int32_t total = 0;
+    for (int i = 0; i < 10; i++) {
+        int32_t counts = move(1);
+        EXPECT_TRUE(counts == 1 || counts == 2);
+        total += counts;
+    }
+    EXPECT_EQ(total, 15);
+}
+
+TEST_F(PointingDeviceAccel, FractionsCarryOverNegative) {
+    set_gain(384);
+
+    int32_t total = 0;
+    for (int i = 0; i < 10; i++) {
+        total += move(-1);
+    }
+    EXPECT_EQ(total, -15);
+}
+
+TEST_F(PointingDeviceAccel, SlowMotionIsNotLost) {
+    set_gain(128);
+
+    int32_t total = 0;
+    for (int i = 0; i < 10; i++) {
+        total += move(1);
+    }
+    EXPECT_EQ(total, 5);
+}
+
+TEST_F(PointingDeviceAccel, ClampsToReportRange) {
+    set_gain(1024);
+
+    EXPECT_EQ(move(XY_REPORT_MAX / 2), XY_REPORT_MAX);
+    pointing_device_accel_reset(&accel);
+    EXPECT_EQ(move(-XY_REPORT_MAX / 2), -XY_REPORT_MAX);
+}
+
+TEST_F(PointingDeviceAccel, ClampedMotionCarriesOver) {
+    set_gain(1024);
+
+    int32_t total = move(10) + move(10) + drain();
+    EXPECT_EQ(total, 80);
+}
+
+TEST_F(PointingDeviceAccel, BacklogIsBounded) {
+    set_gain(1024);
+
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(move(XY_REPORT_MAX), XY_REPORT_MAX);
+    }
+    EXPECT_EQ(drain(), POINTING_DEVICE_ACCEL_MOTION_MAX);
+}
+
+TEST_F(PointingDeviceAccel, LargestGainDoesNotOverflow) {
+    set_gain(UINT16_MAX);
+
+    EXPECT_EQ(move(XY_REPORT_MAX), XY_REPORT_MAX);
+    pointing_device_accel_reset(&accel);
+    EXPECT_EQ(move(XY_REPORT_MIN), -XY_REPORT_MAX);
+    pointing_device_accel_reset(&accel);
+    EXPECT_EQ(move(1), std::min<int32_t>(255, XY_REPORT_MAX));
+    pointing_device_accel_reset(&accel);
+    EXPECT_EQ(move(-1), -std::min<int32_t>(255, XY_REPORT_MAX));
+}
+
+TEST_F(PointingDeviceAccel, SmoothingMovesPartWay) {
+    set_gain(256);
+    set_smoothing(128, 0);
+
+    EXPECT_EQ(move(10), 5);
+    EXPECT_EQ(move(-10), -2);
+}
+
+TEST_F(PointingDeviceAccel, SpeedRaisesSampleWeight) {
+    set_gain(256);
+    set_smoothing(16, 24);
+
+    EXPECT_EQ(move(10), 10);
+}
+
+TEST_F(PointingDeviceAccel, SmoothingSettles) {
+    set_gain(256);
+    set_smoothing(16, 0);
+
+    for (int i = 0; i < 300; i++) {
+        move(10);
+    }
+    EXPECT_EQ(accel.status.x, 10 * 256);
+    EXPECT_EQ(move(10), 10);
+
+    for (int i = 0; i < 300; i++) {
+        move(-10);
+    }
+    EXPECT_EQ(accel.status.x, -10 * 256);
+    EXPECT_EQ(move(-10), -10);
+
+    for (int i = 0; i < 300; i++) {
+        move(0);
+    }
+    EXPECT_EQ(accel.status.x, 0);
+    EXPECT_LT(abs(accel.status.carry_x), 256);
+    EXPECT_EQ(move(0), 0);
+}
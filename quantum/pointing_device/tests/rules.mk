@@ -0,0 +1,18 @@
+pointing_device_accel_DEFS := \
+	-DNO_PRINT \
+	-DNO_DEBUG \
+	-DPOINTING_DEVICE_ACCEL_ENABLE
+pointing_device_accel_SRC := \
+	$(QUANTUM_PATH)/pointing_device/pointing_device_accel.c \
+	$(QUANTUM_PATH)/pointing_device/tests/pointing_device_accel_tests.cpp
+pointing_device_accel_INC := \
+	$(QUANTUM_PATH)/pointing_device \
+	$(TMK_PATH)/protocol
+
+pointing_device_accel_extended_DEFS := \
+	$(pointing_device_accel_DEFS) \
+	-DMOUSE_EXTENDED_REPORT
+pointing_device_accel_extended_SRC := \
+	$(pointing_device_accel_SRC)
+pointing_device_accel_extended_INC := \
+	$(pointing_device_accel_INC)
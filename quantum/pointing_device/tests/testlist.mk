@@ -0,0 +1,3 @@
+TEST_LIST += \
+	pointing_device_accel \
+	pointing_device_accel_extended
@@ -15,6 +15,12 @@ float compute_freq_for_midi_note(uint8_t note) {
     return pow(2.0, (note - 69) / 12.0) * PITCH_STANDARD_A;
 }
 
+const process_record_range_t process_audio_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(AU_ON, AU_TOG),
+    PROCESS_RECORD_RANGE(MUV_IN, MUV_DE),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_audio(uint16_t keycode, keyrecord_t *record) {
     if (keycode == AU_ON && record->event.pressed) {
         audio_on();
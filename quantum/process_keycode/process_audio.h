@@ -3,6 +3,7 @@
 float compute_freq_for_midi_note(uint8_t note);
 
 bool process_audio(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_audio_keycodes[];
 void process_audio_noteon(uint8_t note);
 void process_audio_noteoff(uint8_t note);
 void process_audio_all_notes_off(void);
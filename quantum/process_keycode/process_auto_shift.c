@@ -39,6 +39,44 @@ static uint16_t last_retroshift_time;
 static uint16_t    autoshift_timeout = AUTO_SHIFT_TIMEOUT;
 static uint16_t    autoshift_lastkey = KC_NO;
 static keyrecord_t autoshift_lastrecord;
+#    ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+// Timeout of the key in progress, evaluated once on press instead of on every
+// matrix scan while the key is held.
+static uint16_t autoshift_lastkey_timeout;
+#        define AUTOSHIFT_LASTKEY_TIMEOUT autoshift_lastkey_timeout
+#    else
+#        define AUTOSHIFT_LASTKEY_TIMEOUT autoshift_timeout
+#    endif
+// Basic keycodes that are Auto Shifted by default, so that eligibility is a
+// single bit test per event. These ranges must match the AUTO_SHIFT_ALPHA,
+// AUTO_SHIFT_NUMERIC and AUTO_SHIFT_SPECIAL groups.
+#    define AUTOSHIFT_IN_RANGE(keycode, first, last) ((keycode) >= (first) && (keycode) <= (last))
+#    ifndef NO_AUTO_SHIFT_ALPHA
+#        define AUTOSHIFT_IS_ALPHA(keycode) AUTOSHIFT_IN_RANGE(keycode, KC_A, KC_Z)
+#    else
+#        define AUTOSHIFT_IS_ALPHA(keycode) false
+#    endif
+#    ifndef NO_AUTO_SHIFT_NUMERIC
+#        define AUTOSHIFT_IS_NUMERIC(keycode) AUTOSHIFT_IN_RANGE(keycode, KC_1, KC_0)
+#    else
+#        define AUTOSHIFT_IS_NUMERIC(keycode) false
+#    endif
+#    ifndef NO_AUTO_SHIFT_SPECIAL
+#        define AUTOSHIFT_IS_SPECIAL(keycode) ((keycode) == KC_TAB || AUTOSHIFT_IN_RANGE(keycode, KC_MINUS, KC_SLASH) || (keycode) == KC_NONUS_BACKSLASH)
+#    else
+#        define AUTOSHIFT_IS_SPECIAL(keycode) false
+#    endif
+#    define AUTOSHIFT_DEFAULT_BIT(keycode) ((uint16_t)(AUTOSHIFT_IS_ALPHA(keycode) || AUTOSHIFT_IS_NUMERIC(keycode) || AUTOSHIFT_IS_SPECIAL(keycode)) << ((keycode) % 16))
+#    define AUTOSHIFT_DEFAULT_BITS_4(keycode) (AUTOSHIFT_DEFAULT_BIT(keycode) | AUTOSHIFT_DEFAULT_BIT((keycode) + 1) | AUTOSHIFT_DEFAULT_BIT((keycode) + 2) | AUTOSHIFT_DEFAULT_BIT((keycode) + 3))
+#    define AUTOSHIFT_DEFAULT_WORD(word) (AUTOSHIFT_DEFAULT_BITS_4((word)*16) | AUTOSHIFT_DEFAULT_BITS_4((word)*16 + 4) | AUTOSHIFT_DEFAULT_BITS_4((word)*16 + 8) | AUTOSHIFT_DEFAULT_BITS_4((word)*16 + 12))
+// clang-format off
+static const uint16_t autoshift_default_keys[((1 << 8) + 15) / 16] PROGMEM = {
+    AUTOSHIFT_DEFAULT_WORD(0),  AUTOSHIFT_DEFAULT_WORD(1),  AUTOSHIFT_DEFAULT_WORD(2),  AUTOSHIFT_DEFAULT_WORD(3),
+    AUTOSHIFT_DEFAULT_WORD(4),  AUTOSHIFT_DEFAULT_WORD(5),  AUTOSHIFT_DEFAULT_WORD(6),  AUTOSHIFT_DEFAULT_WORD(7),
+    AUTOSHIFT_DEFAULT_WORD(8),  AUTOSHIFT_DEFAULT_WORD(9),  AUTOSHIFT_DEFAULT_WORD(10), AUTOSHIFT_DEFAULT_WORD(11),
+    AUTOSHIFT_DEFAULT_WORD(12), AUTOSHIFT_DEFAULT_WORD(13), AUTOSHIFT_DEFAULT_WORD(14), AUTOSHIFT_DEFAULT_WORD(15),
+};
+// clang-format on
 // Keys take 8 bits if modifiers are excluded. This records the shift state
 // when pressed for each key, so that can be passed to the release function
 // and it knows which key needs to be released (if shifted is different base).
@@ -68,17 +106,8 @@ __attribute__((weak)) bool get_custom_auto_shifted_key(uint16_t keycode, keyreco
 
 /** \brief Called on physical press, returns whether is Auto Shift key */
 __attribute__((weak)) bool get_auto_shifted_key(uint16_t keycode, keyrecord_t *record) {
-    switch (keycode) {
-#    ifndef NO_AUTO_SHIFT_ALPHA
-        case AUTO_SHIFT_ALPHA:
-#    endif
-#    ifndef NO_AUTO_SHIFT_NUMERIC
-        case AUTO_SHIFT_NUMERIC:
-#    endif
-#    ifndef NO_AUTO_SHIFT_SPECIAL
-        case AUTO_SHIFT_SPECIAL:
-#    endif
-            return true;
+    if (keycode <= UINT8_MAX && (pgm_read_word(&autoshift_default_keys[keycode / 16]) & (uint16_t)1 << keycode % 16)) {
+        return true;
     }
     return get_custom_auto_shifted_key(keycode, record);
 }
@@ -216,6 +245,9 @@ static bool autoshift_press(uint16_t keycode, uint16_t now, keyrecord_t *record)
     autoshift_lastkey           = keycode;
     autoshift_time              = now;
     autoshift_flags.in_progress = true;
+#    ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+    autoshift_lastkey_timeout = get_autoshift_timeout(keycode, record);
+#    endif
 
 #    if !defined(NO_ACTION_ONESHOT) && !defined(NO_ACTION_TAPPING)
     clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
@@ -236,17 +268,7 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
     if (autoshift_flags.in_progress && (keycode == autoshift_lastkey || keycode == KC_NO)) {
         // Process the auto-shiftable key.
         autoshift_flags.in_progress = false;
-        // clang-format off
-        autoshift_flags.lastshifted =
-            autoshift_flags.lastshifted
-            || TIMER_DIFF_16(now, autoshift_time) >=
-#    ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
-                get_autoshift_timeout(autoshift_lastkey, record)
-#    else
-                autoshift_timeout
-#    endif
-        ;
-        // clang-format on
+        autoshift_flags.lastshifted = autoshift_flags.lastshifted || TIMER_DIFF_16(now, autoshift_time) >= AUTOSHIFT_LASTKEY_TIMEOUT;
         set_autoshift_shift_state(autoshift_lastkey, autoshift_flags.lastshifted);
         if (get_mods() & MOD_BIT(KC_LSFT)) {
             autoshift_flags.cancelling_lshift = true;
@@ -302,13 +324,7 @@ static void autoshift_end(uint16_t keycode, uint16_t now, bool matrix_trigger, k
 void autoshift_matrix_scan(void) {
     if (autoshift_flags.in_progress) {
         const uint16_t now = timer_read();
-        if (TIMER_DIFF_16(now, autoshift_time) >=
-#    ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
-            get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord)
-#    else
-            autoshift_timeout
-#    endif
-        ) {
+        if (TIMER_DIFF_16(now, autoshift_time) >= AUTOSHIFT_LASTKEY_TIMEOUT) {
             autoshift_end(autoshift_lastkey, now, true, &autoshift_lastrecord);
         }
     }
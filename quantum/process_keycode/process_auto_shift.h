@@ -48,5 +48,6 @@ uint16_t get_generic_autoshift_timeout(void);
 uint16_t (get_autoshift_timeout)(uint16_t keycode, keyrecord_t *record);
 void     set_autoshift_timeout(uint16_t timeout);
 void     autoshift_matrix_scan(void);
+bool     get_auto_shifted_key(uint16_t keycode, keyrecord_t *record);
 bool     get_custom_auto_shifted_key(uint16_t keycode, keyrecord_t *record);
 // clang-format on
@@ -22,6 +22,11 @@
 #    include "backlight.h"
 #endif
 
+const process_record_range_t process_backlight_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(BL_ON, BL_BRTG),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_backlight(uint16_t keycode, keyrecord_t *record) {
     if (record->event.pressed) {
         switch (keycode) {
@@ -19,3 +19,4 @@
 #include "quantum.h"
 
 bool process_backlight(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_backlight_keycodes[];
@@ -32,6 +32,11 @@ static void tapping_term_report(void) {
 #endif
 }
 
+const process_record_range_t process_dynamic_tapping_term_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(DT_PRNT, DT_DOWN),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_dynamic_tapping_term(uint16_t keycode, keyrecord_t *record) {
     if (record->event.pressed) {
         switch (keycode) {
@@ -18,9 +18,11 @@
 
 #include <stdbool.h>
 #include "action.h"
+#include "process_record_dispatch.h"
 
 #ifndef DYNAMIC_TAPPING_TERM_INCREMENT
 #    define DYNAMIC_TAPPING_TERM_INCREMENT 5
 #endif
 
 bool process_dynamic_tapping_term(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_dynamic_tapping_term_keycodes[];
@@ -20,6 +20,11 @@
  */
 static bool grave_esc_was_shifted = false;
 
+const process_record_range_t process_grave_esc_keycodes[] PROGMEM = {
+    PROCESS_RECORD_KEYCODE(QK_GRAVE_ESCAPE),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_grave_esc(uint16_t keycode, keyrecord_t *record) {
     if (keycode == QK_GRAVE_ESCAPE) {
         const uint8_t mods    = get_mods();
@@ -18,3 +18,4 @@
 #include "quantum.h"
 
 bool process_grave_esc(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_grave_esc_keycodes[];
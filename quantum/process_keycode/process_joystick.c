@@ -6,6 +6,11 @@
 #include <string.h>
 #include <math.h>
 
+const process_record_range_t process_joystick_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(JS_BUTTON0, JS_BUTTON_MAX),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_joystick(uint16_t keycode, keyrecord_t *record) {
     switch (keycode) {
         case JS_BUTTON0 ... JS_BUTTON_MAX:
@@ -4,6 +4,7 @@
 #include "quantum.h"
 
 bool process_joystick(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_joystick_keycodes[];
 
 void joystick_task(void);
 
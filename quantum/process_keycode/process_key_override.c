@@ -21,11 +21,19 @@
 #include "process_key_override.h"
 
 #include <debug.h>
+#include <string.h>
 
 #ifndef KEY_OVERRIDE_REPEAT_DELAY
 #    define KEY_OVERRIDE_REPEAT_DELAY 500
 #endif
 
+// Maximum number of key overrides covered by the lookup index. Longer lists fall back to checking every override.
+#ifndef KEY_OVERRIDE_INDEX_SIZE
+#    define KEY_OVERRIDE_INDEX_SIZE 64
+#endif
+
+_Static_assert(KEY_OVERRIDE_INDEX_SIZE <= UINT8_MAX, "KEY_OVERRIDE_INDEX_SIZE must not exceed 255");
+
 // For benchmarking the time it takes to call process_key_override on every key press (needs keyboard debugging enabled as well)
 // #define BENCH_KEY_OVERRIDE
 
@@ -87,6 +95,95 @@ __attribute__((weak)) const key_override_t **key_overrides = NULL;
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
+// Lookup index, built from key_overrides by key_override_init()
+
+// The list the index was built from, so that it is rebuilt if key_overrides is changed
+static const key_override_t **indexed_overrides = NULL;
+// Number of overrides in the list
+static uint16_t override_count = 0;
+// Whether the list fits in the index
+static bool use_index = false;
+// Positions in key_overrides, sorted by trigger keycode, and by position for equal triggers
+static uint8_t trigger_index[KEY_OVERRIDE_INDEX_SIZE];
+// For each modifier bit, the layers of the overrides that it is a trigger modifier of
+static layer_state_t mod_override_layers[8];
+// Layers of the overrides that activate without modifiers
+static layer_state_t no_mod_override_layers = 0;
+
+static void build_key_override_index(void) {
+    indexed_overrides      = key_overrides;
+    override_count         = 0;
+    no_mod_override_layers = 0;
+    memset(mod_override_layers, 0, sizeof(mod_override_layers));
+
+    if (key_overrides == NULL) {
+        return;
+    }
+
+    for (; key_overrides[override_count] != NULL; override_count++) {
+        const key_override_t *const override = key_overrides[override_count];
+
+        if (override->trigger_mods == 0) {
+            no_mod_override_layers |= override->layers;
+        }
+        for (uint8_t mod = 0; mod < 8; mod++) {
+            if (override->trigger_mods & (1 << mod)) {
+                mod_override_layers[mod] |= override->layers;
+            }
+        }
+    }
+
+    use_index = override_count <= KEY_OVERRIDE_INDEX_SIZE;
+    if (!use_index) {
+        key_override_printf("Too many key overrides to index: %u\n", override_count);
+        return;
+    }
+
+    // Stable insertion sort, keeping the order of overrides with the same trigger
+    for (uint8_t i = 0; i < override_count; i++) {
+        const uint16_t trigger = key_overrides[i]->trigger;
+
+        uint8_t j = i;
+        for (; j > 0 && key_overrides[trigger_index[j - 1]]->trigger > trigger; j--) {
+            trigger_index[j] = trigger_index[j - 1];
+        }
+        trigger_index[j] = i;
+    }
+}
+
+/** Returns the layers on which an override can activate with the given modifiers held. An override needs at least one of its trigger modifiers held, both when it needs all of them and with ko_option_one_mod. */
+static layer_state_t override_layers_for_mods(const uint8_t mods) {
+    layer_state_t layers = no_mod_override_layers;
+    for (uint8_t mod = 0; mod < 8; mod++) {
+        if (mods & (1 << mod)) {
+            layers |= mod_override_layers[mod];
+        }
+    }
+    return layers;
+}
+
+/** Finds the first entry in the index with the given trigger. Returns the number of entries with that trigger. */
+static uint8_t find_trigger(const uint16_t trigger, uint8_t *const first) {
+    uint8_t low = 0, high = override_count;
+    while (low < high) {
+        const uint8_t middle = low + (high - low) / 2;
+        if (key_overrides[trigger_index[middle]]->trigger < trigger) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    *first = low;
+    for (high = low; high < override_count && key_overrides[trigger_index[high]]->trigger == trigger; high++) {
+    }
+    return high - low;
+}
+
+void key_override_init(void) {
+    build_key_override_index();
+}
+
 void key_override_on(void) {
     enabled = true;
     key_override_printf("Key override ON\n");
@@ -243,141 +340,191 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_overrides == NULL) {
-        return true;
+/** Checks whether the override should activate for the key event. */
+static bool should_activate_override(const key_override_t *const override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0;; i++) {
-        const key_override_t *const override = key_overrides[i];
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
 
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    const bool is_trigger = override->trigger == keycode;
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
-        }
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
 
-        const bool is_trigger = override->trigger == keycode;
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
-        }
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
-        }
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
-        }
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+    return true;
+}
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+/** Activates the override. Returns true if the key action for `keycode` should be sent */
+static bool activate_override(const key_override_t *const override, const uint16_t keycode, const bool key_down, const bool is_mod) {
+    const bool trigger_down = override->trigger == keycode && key_down;
+    const bool no_trigger   = override->trigger == KC_NO;
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
+    key_override_printf("Activating override\n");
+
+    clear_active_override(false);
+
+    active_override                 = override;
+    active_override_trigger_is_down = true;
+
+    set_suppressed_override_mods(override->suppressed_mods);
+
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_KEY(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
         }
+    }
 
-        key_override_printf("Activating override\n");
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        clear_active_override(false);
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_KEY(override->trigger)) {
-                del_key(override->trigger);
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_KEY(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                unregister_code(override->trigger);
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
         }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    return !trigger_down;
+}
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+/** Iterates through the candidate key overrides and tries activating each, until it finds one that activates or runs out of candidates. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    *activated = false;
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
-        }
+    if (key_overrides == NULL) {
+        return true;
+    }
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+    // key_overrides may have been pointed at a different list after key_override_init()
+    if (key_overrides != indexed_overrides) {
+        build_key_override_index();
+    }
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_KEY(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
-                }
+    // Filter events that no override can activate for with these modifiers on this layer, without looking at any of them
+    if ((override_layers_for_mods(active_mods) & ((layer_state_t)1 << layer)) == 0) {
+        return true;
+    }
+
+    if (!use_index) {
+        for (uint16_t i = 0; i < override_count; i++) {
+            if (should_activate_override(key_overrides[i], keycode, layer, key_down, is_mod, active_mods)) {
+                *activated = true;
+                return activate_override(key_overrides[i], keycode, key_down, is_mod);
             }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
         }
+        return true;
+    }
 
-        *activated = true;
+    // An override can only activate if its trigger is the key of this event, the last key that was pressed down, or no key at all. Walk the overrides for these triggers in the order they are listed in.
+    const uint16_t triggers[]  = {keycode, last_key_down, KC_NO};
+    uint8_t        position[3] = {0};
+    uint8_t        end[3]      = {0};
 
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+    for (uint8_t t = 0; t < 3; t++) {
+        if ((t > 0 && triggers[t] == triggers[0]) || (t > 1 && triggers[t] == triggers[1])) {
+            continue;
+        }
+        end[t] = position[t] + find_trigger(triggers[t], &position[t]);
     }
 
-    *activated = false;
+    while (true) {
+        int8_t next = -1;
+        for (uint8_t t = 0; t < 3; t++) {
+            if (position[t] < end[t] && (next < 0 || trigger_index[position[t]] < trigger_index[position[next]])) {
+                next = t;
+            }
+        }
+        if (next < 0) {
+            break;
+        }
+
+        const key_override_t *const override = key_overrides[trigger_index[position[next]++]];
+        if (should_activate_override(override, keycode, layer, key_down, is_mod, active_mods)) {
+            *activated = true;
+            return activate_override(override, keycode, key_down, is_mod);
+        }
+    }
 
     return true;
 }
@@ -396,7 +543,7 @@ void key_override_task(void) {
     }
 }
 
-bool process_key_override(const uint16_t keycode, const keyrecord_t *const record) {
+bool process_key_override(const uint16_t keycode, keyrecord_t *const record) {
 #ifdef BENCH_KEY_OVERRIDE
     uint16_t start = timer_read();
 #endif
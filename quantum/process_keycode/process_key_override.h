@@ -91,6 +91,9 @@ typedef struct {
 /** Define this as a null-terminated array of pointers to key overrides. These key overrides will be used by qmk. */
 extern const key_override_t **key_overrides;
 
+/** Builds the lookup index from key_overrides, called on keyboard init */
+void key_override_init(void);
+
 /** Turns key overrides on */
 void key_override_on(void);
 
@@ -104,7 +107,7 @@ void key_override_toggle(void);
 bool key_override_is_enabled(void);
 
 /** Handling of key overrides and its implemented keycodes */
-bool process_key_override(const uint16_t keycode, const keyrecord_t *const record);
+bool process_key_override(const uint16_t keycode, keyrecord_t *const record);
 
 /** Perform any deferred keys */
 void key_override_task(void);
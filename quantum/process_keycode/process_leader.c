@@ -23,16 +23,124 @@
 #        define LEADER_TIMEOUT 300
 #    endif
 
+#    ifndef LEADER_SEQUENCES_INDEX_SIZE
+#        define LEADER_SEQUENCES_INDEX_SIZE 32
+#    endif
+
 __attribute__((weak)) void leader_start(void) {}
 
 __attribute__((weak)) void leader_end(void) {}
 
+__attribute__((weak)) const leader_sequence_t *leader_sequences = NULL;
+
 // Leader key stuff
 bool     leading     = false;
 uint16_t leader_time = 0;
 
-uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
-uint8_t  leader_sequence_size = 0;
+uint16_t leader_sequence[LEADER_SEQUENCE_LENGTH] = {0, 0, 0, 0, 0};
+uint8_t  leader_sequence_size                     = 0;
+
+/* The sequence table is walked like a prefix trie: sorted by keys, all the
+ * sequences starting with the keys typed so far form a contiguous range, and
+ * each further key narrows it down with two binary searches. A sequence
+ * fires as soon as it is the only candidate left, and the leader ends early
+ * once there are none.
+ */
+
+// The table the index was built from, so that it is rebuilt if leader_sequences is changed
+static const leader_sequence_t *indexed_sequences = NULL;
+// Number of sequences in the table
+static uint8_t sequence_count = 0;
+// Positions in leader_sequences, sorted by keys, and by position for equal keys
+static uint8_t sequence_index[LEADER_SEQUENCES_INDEX_SIZE];
+// Range of the index that still matches the keys typed so far
+static uint8_t candidates_first = 0;
+static uint8_t candidates_last  = 0;
+
+static uint16_t sequence_key(uint8_t position, uint8_t depth) {
+    return pgm_read_word(&leader_sequences[sequence_index[position]].keys[depth]);
+}
+
+static int8_t compare_sequences(uint8_t a, uint8_t b) {
+    for (uint8_t depth = 0; depth < LEADER_SEQUENCE_LENGTH; depth++) {
+        uint16_t key_a = pgm_read_word(&leader_sequences[a].keys[depth]);
+        uint16_t key_b = pgm_read_word(&leader_sequences[b].keys[depth]);
+        if (key_a != key_b) {
+            return key_a < key_b ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+static void build_leader_sequence_index(void) {
+    indexed_sequences = leader_sequences;
+    sequence_count    = 0;
+
+    for (; pgm_read_ptr(&leader_sequences[sequence_count].callback) != NULL; sequence_count++) {
+        if (sequence_count == LEADER_SEQUENCES_INDEX_SIZE) {
+            dprintf("Too many leader sequences, only the first %u are used\n", LEADER_SEQUENCES_INDEX_SIZE);
+            break;
+        }
+    }
+
+    // Stable insertion sort, keeping the order of sequences with the same keys
+    for (uint8_t i = 0; i < sequence_count; i++) {
+        uint8_t j = i;
+        for (; j > 0 && compare_sequences(sequence_index[j - 1], i) > 0; j--) {
+            sequence_index[j] = sequence_index[j - 1];
+        }
+        sequence_index[j] = i;
+    }
+}
+
+/** Finds the first candidate whose key at `depth` is not below `keycode`, or above it if `after` is set. */
+static uint8_t find_candidate(uint8_t depth, uint16_t keycode, bool after) {
+    uint8_t low = candidates_first, high = candidates_last;
+    while (low < high) {
+        uint8_t  middle = low + (high - low) / 2;
+        uint16_t key    = sequence_key(middle, depth);
+        if (key < keycode || (after && key == keycode)) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/** Returns the sequence that matches the keys typed so far exactly, if any. */
+static const leader_sequence_t *exact_match(void) {
+    if (candidates_first == candidates_last) {
+        return NULL;
+    }
+    // The shortest candidate sorts first, since unused keys are 0
+    if (leader_sequence_size < LEADER_SEQUENCE_LENGTH && sequence_key(candidates_first, leader_sequence_size) != 0) {
+        return NULL;
+    }
+    return &leader_sequences[sequence_index[candidates_first]];
+}
+
+static void end_leader_sequence(const leader_sequence_t *match) {
+    leading = false;
+    leader_end();
+    if (match) {
+        void (*callback)(void) = pgm_read_ptr(&match->callback);
+        callback();
+    }
+}
+
+/** Narrows the candidates down to the sequences continuing with `keycode`, which has already been recorded. */
+static void match_leader_key(uint16_t keycode) {
+    uint8_t depth    = leader_sequence_size - 1;
+    candidates_first = find_candidate(depth, keycode, false);
+    candidates_last  = find_candidate(depth, keycode, true);
+
+    if (candidates_first == candidates_last) {
+        end_leader_sequence(NULL);
+    } else if (candidates_last - candidates_first == 1 && exact_match()) {
+        end_leader_sequence(exact_match());
+    }
+}
 
 void qk_leader_start(void) {
     if (leading) {
@@ -43,6 +151,29 @@ void qk_leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+
+    if (leader_sequences != NULL) {
+        if (leader_sequences != indexed_sequences) {
+            build_leader_sequence_index();
+        }
+        candidates_first = 0;
+        candidates_last  = sequence_count;
+    }
+}
+
+/** \brief Ends a sequence from the leader_sequences table once the leader times out */
+void leader_task(void) {
+    if (!leading || leader_sequences == NULL) {
+        return;
+    }
+#    ifdef LEADER_NO_TIMEOUT
+    if (leader_sequence_size == 0) {
+        return;
+    }
+#    endif
+    if (timer_elapsed(leader_time) > LEADER_TIMEOUT) {
+        end_leader_sequence(exact_match());
+    }
 }
 
 bool process_leader(uint16_t keycode, keyrecord_t *record) {
@@ -69,6 +200,9 @@ bool process_leader(uint16_t keycode, keyrecord_t *record) {
 #    ifdef LEADER_PER_KEY_TIMING
                 leader_time = timer_read();
 #    endif
+                if (leader_sequences != NULL) {
+                    match_leader_key(keycode);
+                }
                 return false;
             }
         } else {
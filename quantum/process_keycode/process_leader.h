@@ -18,7 +18,32 @@
 
 #include "quantum.h"
 
+#define LEADER_SEQUENCE_LENGTH 5
+
+/**
+ * @brief A leader sequence and the function it runs.
+ *
+ * Keys after the last one of a shorter sequence are 0. Tables of sequences
+ * are terminated by LEADER_SEQUENCES_END, and should be declared PROGMEM.
+ */
+typedef struct {
+    uint16_t keys[LEADER_SEQUENCE_LENGTH];
+    void (*callback)(void);
+} leader_sequence_t;
+
+#define LEADER_SEQUENCE(callback, ...) \
+    { {__VA_ARGS__}, (callback) }
+#define LEADER_SEQUENCES_END \
+    { {0}, NULL }
+
+/**
+ * @brief The keymap's table of leader sequences, NULL if it uses
+ * LEADER_DICTIONARY() instead.
+ */
+extern const leader_sequence_t *leader_sequences;
+
 bool process_leader(uint16_t keycode, keyrecord_t *record);
+void leader_task(void);
 
 void leader_start(void);
 void leader_end(void);
@@ -30,10 +55,10 @@ void qk_leader_start(void);
 #define SEQ_FOUR_KEYS(key1, key2, key3, key4) if (leader_sequence[0] == (key1) && leader_sequence[1] == (key2) && leader_sequence[2] == (key3) && leader_sequence[3] == (key4) && leader_sequence[4] == 0)
 #define SEQ_FIVE_KEYS(key1, key2, key3, key4, key5) if (leader_sequence[0] == (key1) && leader_sequence[1] == (key2) && leader_sequence[2] == (key3) && leader_sequence[3] == (key4) && leader_sequence[4] == (key5))
 
-#define LEADER_EXTERNS()                \
-    extern bool     leading;            \
-    extern uint16_t leader_time;        \
-    extern uint16_t leader_sequence[5]; \
+#define LEADER_EXTERNS()                                     \
+    extern bool     leading;                                 \
+    extern uint16_t leader_time;                             \
+    extern uint16_t leader_sequence[LEADER_SEQUENCE_LENGTH]; \
     extern uint8_t  leader_sequence_size
 
 #ifdef LEADER_NO_TIMEOUT
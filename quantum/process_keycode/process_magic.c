@@ -34,6 +34,15 @@ float cg_norm_song[][2] = CG_NORM_SONG;
 float cg_swap_song[][2] = CG_SWAP_SONG;
 #endif
 
+const process_record_range_t process_magic_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(MAGIC_SWAP_CONTROL_CAPSLOCK, MAGIC_TOGGLE_ALT_GUI),
+    PROCESS_RECORD_RANGE(MAGIC_SWAP_LCTL_LGUI, MAGIC_EE_HANDS_RIGHT),
+    PROCESS_RECORD_KEYCODE(MAGIC_TOGGLE_GUI),
+    PROCESS_RECORD_KEYCODE(MAGIC_TOGGLE_CONTROL_CAPSLOCK),
+    PROCESS_RECORD_RANGE(MAGIC_SWAP_ESCAPE_CAPSLOCK, MAGIC_TOGGLE_ESCAPE_CAPSLOCK),
+    PROCESS_RECORD_RANGES_END,
+};
+
 /**
  * MAGIC actions (BOOTMAGIC without the boot)
  */
@@ -18,3 +18,4 @@
 #include "quantum.h"
 
 bool process_magic(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_magic_keycodes[];
@@ -72,6 +72,11 @@ uint8_t midi_compute_note(uint16_t keycode) {
     return 12 * midi_config.octave + (keycode - MIDI_TONE_MIN) + midi_config.transpose;
 }
 
+const process_record_range_t process_midi_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(MI_C, MI_BENDU),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_midi(uint16_t keycode, keyrecord_t *record) {
     switch (keycode) {
         case MIDI_TONE_MIN ... MIDI_TONE_MAX: {
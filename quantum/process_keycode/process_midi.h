@@ -44,6 +44,7 @@ extern midi_config_t midi_config;
 
 void midi_init(void);
 bool process_midi(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_midi_keycodes[];
 
 #        define MIDI_INVALID_NOTE 0xFF
 #        define MIDI_TONE_COUNT (MIDI_TONE_MAX - MIDI_TONE_MIN + 1)
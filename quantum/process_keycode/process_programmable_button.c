@@ -18,6 +18,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "process_programmable_button.h"
 #include "programmable_button.h"
 
+const process_record_range_t process_programmable_button_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(PROGRAMMABLE_BUTTON_MIN, PROGRAMMABLE_BUTTON_MAX),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_programmable_button(uint16_t keycode, keyrecord_t *record) {
     if (keycode >= PROGRAMMABLE_BUTTON_MIN && keycode <= PROGRAMMABLE_BUTTON_MAX) {
         uint8_t button = keycode - PROGRAMMABLE_BUTTON_MIN + 1;
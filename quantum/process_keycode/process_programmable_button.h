@@ -21,3 +21,4 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "quantum.h"
 
 bool process_programmable_button(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_programmable_button_keycodes[];
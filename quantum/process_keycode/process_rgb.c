@@ -47,10 +47,16 @@ static void __attribute__((noinline, unused)) handleKeycodeRGBMode(const uint8_t
     }
 }
 
+const process_record_range_t process_rgb_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(RGB_TOG, RGB_MODE_RGBTEST),
+    PROCESS_RECORD_KEYCODE(RGB_MODE_TWINKLE),
+    PROCESS_RECORD_RANGES_END,
+};
+
 /**
  * Handle keycodes for both rgblight and rgbmatrix
  */
-bool process_rgb(const uint16_t keycode, const keyrecord_t *record) {
+bool process_rgb(const uint16_t keycode, keyrecord_t *record) {
     // need to trigger on key-up for edge-case issue
 #ifndef RGB_TRIGGER_ON_KEYDOWN
     if (!record->event.pressed) {
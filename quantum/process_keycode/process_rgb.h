@@ -17,4 +17,5 @@
 
 #include "quantum.h"
 
-bool process_rgb(const uint16_t keycode, const keyrecord_t *record);
+bool process_rgb(const uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_rgb_keycodes[];
@@ -20,6 +20,11 @@ bool preprocess_secure(uint16_t keycode, keyrecord_t *record) {
     return true;
 }
 
+const process_record_range_t process_secure_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(SECURE_LOCK, SECURE_REQUEST),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_secure(uint16_t keycode, keyrecord_t *record) {
 #ifndef SECURE_DISABLE_KEYCODES
     if (!record->event.pressed) {
@@ -5,6 +5,7 @@
 
 #include <stdbool.h>
 #include "action.h"
+#include "process_record_dispatch.h"
 
 /** \brief Intercept keycodes and detect unlock sequences
  */
@@ -13,3 +14,4 @@ bool preprocess_secure(uint16_t keycode, keyrecord_t *record);
 /** \brief Handle any secure specific keycodes
  */
 bool process_secure(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_secure_keycodes[];
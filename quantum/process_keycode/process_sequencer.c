@@ -16,6 +16,11 @@
 
 #include "process_sequencer.h"
 
+const process_record_range_t process_sequencer_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(SQ_ON, SEQUENCER_TRACK_MAX),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_sequencer(uint16_t keycode, keyrecord_t *record) {
     if (record->event.pressed) {
         switch (keycode) {
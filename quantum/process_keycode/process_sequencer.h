@@ -19,3 +19,4 @@
 #include "quantum.h"
 
 bool process_sequencer(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_sequencer_keycodes[];
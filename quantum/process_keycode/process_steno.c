@@ -156,6 +156,11 @@ __attribute__((weak)) bool process_steno_user(uint16_t keycode, keyrecord_t *rec
     return true;
 }
 
+const process_record_range_t process_steno_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(QK_STENO, QK_STENO_MAX),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_steno(uint16_t keycode, keyrecord_t *record) {
     if (keycode < QK_STENO || keycode > QK_STENO_MAX) {
         return true; // Not a steno key, pass it further along the chain
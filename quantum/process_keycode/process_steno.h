@@ -33,6 +33,7 @@ typedef enum {
 } steno_mode_t;
 
 bool process_steno(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_steno_keycodes[];
 #ifdef STENO_ENABLE_ALL
 void steno_init(void);
 void steno_set_mode(steno_mode_t mode);
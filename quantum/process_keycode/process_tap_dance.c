@@ -14,9 +14,24 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "quantum.h"
+#include "deferred_exec.h"
 
-static uint16_t active_td;
-static uint16_t last_tap_time;
+#ifndef TAP_DANCE_MAX_CONCURRENT
+#    define TAP_DANCE_MAX_CONCURRENT 1
+#endif
+
+/* Dances that are waiting for another tap, oldest first. Each has its own
+ * deadline in the executor table, so nothing is checked while idle.
+ */
+typedef struct {
+    uint8_t        index;
+    deferred_token token;
+} tap_dance_active_t;
+
+static tap_dance_active_t  active_dances[TAP_DANCE_MAX_CONCURRENT];
+static uint8_t             active_dance_count = 0;
+static deferred_executor_t tap_dance_executors[TAP_DANCE_MAX_CONCURRENT];
+static uint32_t            last_tap_dance_exec = 0;
 
 void qk_tap_dance_pair_on_each_tap(qk_tap_dance_state_t *state, void *user_data) {
     qk_tap_dance_pair_t *pair = (qk_tap_dance_pair_t *)user_data;
@@ -98,6 +113,28 @@ static inline void process_tap_dance_action_on_reset(qk_tap_dance_action_t *acti
     action->state = (const qk_tap_dance_state_t){0};
 }
 
+static int8_t find_active_dance(uint8_t index) {
+    for (int8_t i = 0; i < active_dance_count; i++) {
+        if (active_dances[i].index == index) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void deactivate_dance(qk_tap_dance_action_t *action) {
+    int8_t i = find_active_dance(action - tap_dance_actions);
+    if (i < 0) {
+        return;
+    }
+
+    cancel_deferred_exec_advanced(tap_dance_executors, TAP_DANCE_MAX_CONCURRENT, active_dances[i].token);
+    active_dance_count--;
+    for (; i < active_dance_count; i++) {
+        active_dances[i] = active_dances[i + 1];
+    }
+}
+
 static inline void process_tap_dance_action_on_dance_finished(qk_tap_dance_action_t *action) {
     if (!action->state.finished) {
         action->state.finished = true;
@@ -108,30 +145,79 @@ static inline void process_tap_dance_action_on_dance_finished(qk_tap_dance_actio
         send_keyboard_report();
         _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_dance_finished);
     }
-    active_td = 0;
+    deactivate_dance(action);
     if (!action->state.pressed) {
         // There will not be a key release event, so reset now.
         process_tap_dance_action_on_reset(action);
     }
 }
 
-void preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
-    qk_tap_dance_action_t *action;
+static uint32_t tap_dance_timeout(uint32_t trigger_time, void *cb_arg) {
+    qk_tap_dance_action_t *action = (qk_tap_dance_action_t *)cb_arg;
 
-    if (!record->event.pressed) return;
+    if (find_active_dance(action - tap_dance_actions) < 0) {
+        return 0;
+    }
 
-    if (!active_td || keycode == active_td) return;
+    // Dances always finish in the order they were started, even if an earlier one has a longer tapping term
+    while (active_dance_count) {
+        qk_tap_dance_action_t *oldest = &tap_dance_actions[active_dances[0].index];
+        process_tap_dance_action_on_dance_finished(oldest);
+        if (oldest == action) {
+            break;
+        }
+    }
+    return 0;
+}
 
-    action                             = &tap_dance_actions[TD_INDEX(active_td)];
-    action->state.interrupted          = true;
-    action->state.interrupting_keycode = keycode;
-    process_tap_dance_action_on_dance_finished(action);
+static void activate_dance(qk_tap_dance_action_t *action, uint32_t timeout) {
+    int8_t i = find_active_dance(action - tap_dance_actions);
+    if (i >= 0) {
+        extend_deferred_exec_advanced(tap_dance_executors, TAP_DANCE_MAX_CONCURRENT, active_dances[i].token, timeout);
+        return;
+    }
+
+    if (active_dance_count == TAP_DANCE_MAX_CONCURRENT) {
+        process_tap_dance_action_on_dance_finished(&tap_dance_actions[active_dances[0].index]);
+    }
+
+    active_dances[active_dance_count].index = action - tap_dance_actions;
+    active_dances[active_dance_count].token = defer_exec_advanced(tap_dance_executors, TAP_DANCE_MAX_CONCURRENT, timeout, tap_dance_timeout, action);
+    active_dance_count++;
+}
+
+static void interrupt_dances(uint8_t count, uint16_t keycode) {
+    while (count-- && active_dance_count) {
+        qk_tap_dance_action_t *action      = &tap_dance_actions[active_dances[0].index];
+        action->state.interrupted          = true;
+        action->state.interrupting_keycode = keycode;
+        process_tap_dance_action_on_dance_finished(action);
+    }
+}
+
+void preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed || !active_dance_count) return;
+
+    if (keycode >= QK_TAP_DANCE && keycode <= QK_TAP_DANCE_MAX) {
+        // Another tap of a dance in progress, or a new dance that fits alongside the others
+        if (find_active_dance(TD_INDEX(keycode)) >= 0 || active_dance_count < TAP_DANCE_MAX_CONCURRENT) return;
+
+        // Make room by finishing the oldest dance
+        interrupt_dances(1, keycode);
+    } else {
+        interrupt_dances(active_dance_count, keycode);
+    }
 
     // Tap dance actions can leave some weak mods active (e.g., if the tap dance is mapped to a keycode with
     // modifiers), but these weak mods should not affect the keypress which interrupted the tap dance.
     clear_weak_mods();
 }
 
+const process_record_range_t process_tap_dance_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(QK_TAP_DANCE, QK_TAP_DANCE_MAX),
+    PROCESS_RECORD_RANGES_END,
+};
+
 bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
     qk_tap_dance_action_t *action;
 
@@ -141,9 +227,13 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 
             action->state.pressed = record->event.pressed;
             if (record->event.pressed) {
-                last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action);
-                active_td = action->state.finished ? 0 : keycode;
+                if (action->state.finished) {
+                    deactivate_dance(action);
+                } else {
+                    // Finish once more than the tapping term has passed since this tap
+                    activate_dance(action, GET_TAPPING_TERM(keycode, record) + 1);
+                }
             } else {
                 if (action->state.finished) {
                     process_tap_dance_action_on_reset(action);
@@ -157,17 +247,12 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 }
 
 void tap_dance_task() {
-    qk_tap_dance_action_t *action;
-
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    if (!active_dance_count) return;
 
-    action = &tap_dance_actions[TD_INDEX(active_td)];
-    if (!action->state.interrupted) {
-        process_tap_dance_action_on_dance_finished(action);
-    }
+    deferred_exec_advanced_task(tap_dance_executors, TAP_DANCE_MAX_CONCURRENT, &last_tap_dance_exec);
 }
 
 void reset_tap_dance(qk_tap_dance_state_t *state) {
-    active_td = 0;
+    deactivate_dance((qk_tap_dance_action_t *)state);
     process_tap_dance_action_on_reset((qk_tap_dance_action_t *)state);
 }
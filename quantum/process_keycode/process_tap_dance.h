@@ -83,6 +83,7 @@ void reset_tap_dance(qk_tap_dance_state_t *state);
 
 void preprocess_tap_dance(uint16_t keycode, keyrecord_t *record);
 bool process_tap_dance(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_tap_dance_keycodes[];
 void tap_dance_task(void);
 
 void qk_tap_dance_pair_on_each_tap(qk_tap_dance_state_t *state, void *user_data);
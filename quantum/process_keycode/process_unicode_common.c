@@ -23,6 +23,14 @@ uint8_t          unicode_saved_mods;
 bool             unicode_saved_caps_lock;
 bool             unicode_saved_num_lock;
 
+#ifdef SEND_STRING_ASYNC
+// The hex digits are typed through the send_string queue, but starting and
+// finishing input press keys directly, so the queue is played back in between
+#    define unicode_flush() send_string_flush()
+#else
+#    define unicode_flush()
+#endif
+
 #if UNICODE_SELECTED_MODES != -1
 static uint8_t selected[]     = {UNICODE_SELECTED_MODES};
 static int8_t  selected_count = sizeof selected / sizeof *selected;
@@ -156,6 +164,37 @@ __attribute__((weak)) void unicode_input_finish(void) {
     set_mods(unicode_saved_mods); // Reregister previously set mods
 }
 
+__attribute__((weak)) void unicode_input_next(void) {
+    switch (unicode_config.input_mode) {
+        case UC_MAC:
+            // Unicode Hex Input keeps accepting sequences while the key is held
+            return;
+        case UC_LNX:
+            tap_code(KC_SPACE);
+            tap_code16(UNICODE_KEY_LNX);
+            break;
+        case UC_WIN:
+            unregister_code(KC_LEFT_ALT);
+            register_code(KC_LEFT_ALT);
+            wait_ms(UNICODE_TYPE_DELAY);
+            tap_code(KC_KP_PLUS);
+            break;
+        case UC_WINC:
+            tap_code(KC_ENTER);
+            tap_code(UNICODE_KEY_WINC);
+            tap_code(KC_U);
+            break;
+        case UC_EMACS:
+            tap_code16(KC_ENTER);
+            tap_code16(LCTL(KC_X));
+            tap_code16(KC_8);
+            tap_code16(KC_ENTER);
+            break;
+    }
+
+    wait_ms(UNICODE_TYPE_DELAY);
+}
+
 __attribute__((weak)) void unicode_input_cancel(void) {
     switch (unicode_config.input_mode) {
         case UC_MAC:
@@ -224,13 +263,11 @@ void register_hex32(uint32_t hex) {
     }
 }
 
-void register_unicode(uint32_t code_point) {
-    if (code_point > 0x10FFFF || (code_point > 0xFFFF && unicode_config.input_mode == UC_WIN)) {
-        // Code point out of range, do nothing
-        return;
-    }
+static bool is_code_point_in_range(uint32_t code_point) {
+    return code_point <= 0x10FFFF && (code_point <= 0xFFFF || unicode_config.input_mode != UC_WIN);
+}
 
-    unicode_input_start();
+static void register_code_point(uint32_t code_point) {
     if (code_point > 0xFFFF && unicode_config.input_mode == UC_MAC) {
         // Convert code point to UTF-16 surrogate pair on macOS
         code_point -= 0x10000;
@@ -240,6 +277,18 @@ void register_unicode(uint32_t code_point) {
     } else {
         register_hex32(code_point);
     }
+    unicode_flush();
+}
+
+void register_unicode(uint32_t code_point) {
+    if (!is_code_point_in_range(code_point)) {
+        // Code point out of range, do nothing
+        return;
+    }
+
+    unicode_flush();
+    unicode_input_start();
+    register_code_point(code_point);
     unicode_input_finish();
 }
 
@@ -248,14 +297,40 @@ void send_unicode_string(const char *str) {
         return;
     }
 
+#ifdef UNICODE_BATCH_STRINGS
+    // Start input once for the whole string, and only separate the code points
+    bool started = false;
+#endif
+
     while (*str) {
         int32_t code_point = 0;
         str                = decode_utf8(str, &code_point);
 
+#ifdef UNICODE_BATCH_STRINGS
+        if (code_point < 0 || !is_code_point_in_range(code_point)) {
+            continue;
+        }
+
+        if (started) {
+            unicode_input_next();
+        } else {
+            unicode_flush();
+            unicode_input_start();
+            started = true;
+        }
+        register_code_point(code_point);
+#else
         if (code_point >= 0) {
             register_unicode(code_point);
         }
+#endif
+    }
+
+#ifdef UNICODE_BATCH_STRINGS
+    if (started) {
+        unicode_input_finish();
     }
+#endif
 }
 
 // clang-format off
@@ -299,6 +374,15 @@ static void audio_helper(void) {
 
 // clang-format on
 
+#if !defined(UCIS_ENABLE)
+const process_record_range_t process_unicode_common_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(UNICODE_MODE_FORWARD, UNICODE_MODE_WINC),
+    PROCESS_RECORD_KEYCODE(UNICODE_MODE_EMACS),
+    PROCESS_RECORD_RANGE(QK_UNICODE, QK_UNICODE_MAX),
+    PROCESS_RECORD_RANGES_END,
+};
+#endif
+
 bool process_unicode_common(uint16_t keycode, keyrecord_t *record) {
     if (record->event.pressed) {
         bool shifted = get_mods() & MOD_MASK_SHIFT;
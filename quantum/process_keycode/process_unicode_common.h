@@ -85,6 +85,7 @@ void    persist_unicode_input_mode(void);
 
 void unicode_input_start(void);
 void unicode_input_finish(void);
+void unicode_input_next(void);
 void unicode_input_cancel(void);
 
 void register_hex(uint16_t hex);
@@ -94,6 +95,7 @@ void register_unicode(uint32_t code_point);
 void send_unicode_string(const char *str);
 
 bool process_unicode_common(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_unicode_common_keycodes[];
 
 #define UC_BSPC UC(0x0008)
 #define UC_SPC UC(0x0020)
@@ -0,0 +1,288 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+/*
+ * Each handler in the pipeline either observes every key event, or declares
+ * the keycode ranges it consumes. By default every handler is offered every
+ * event, in pipeline order.
+ *
+ * Defining PROCESS_RECORD_DISPATCH_SIZE enables an index of that many
+ * segments, built by keyboard_init(). The ranges of all handlers split the
+ * keycode space into segments, each of which is indexed with a bitmask of the
+ * handlers interested in it. Dispatching an event then takes a binary search
+ * over the segments, and calls only the interested handlers -- rather than
+ * every enabled feature running its own switch over the keycode.
+ *
+ * The index only ever narrows down which handlers are called, every handler
+ * still checks the keycode itself. If it runs out of room, the remaining
+ * handlers simply observe every event instead.
+ */
+
+#if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
+// Must run asap to ensure all keypresses are recorded.
+#    define PROCESS_RECORD_DYNAMIC_MACRO PROCESS_RECORD_OBSERVE_ALL(process_dynamic_macro)
+#else
+#    define PROCESS_RECORD_DYNAMIC_MACRO
+#endif
+#if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
+#    define PROCESS_RECORD_CLICKY PROCESS_RECORD_OBSERVE_ALL(process_clicky)
+#else
+#    define PROCESS_RECORD_CLICKY
+#endif
+#ifdef HAPTIC_ENABLE
+#    define PROCESS_RECORD_HAPTIC PROCESS_RECORD_OBSERVE_ALL(process_haptic)
+#else
+#    define PROCESS_RECORD_HAPTIC
+#endif
+#if defined(VIA_ENABLE)
+#    define PROCESS_RECORD_VIA PROCESS_RECORD_KEYCODES(process_record_via, process_record_via_keycodes)
+#else
+#    define PROCESS_RECORD_VIA
+#endif
+#define PROCESS_RECORD_KB PROCESS_RECORD_OBSERVE_ALL(process_record_kb)
+#if defined(SECURE_ENABLE)
+#    define PROCESS_RECORD_SECURE PROCESS_RECORD_KEYCODES(process_secure, process_secure_keycodes)
+#else
+#    define PROCESS_RECORD_SECURE
+#endif
+#if defined(SEQUENCER_ENABLE)
+#    define PROCESS_RECORD_SEQUENCER PROCESS_RECORD_KEYCODES(process_sequencer, process_sequencer_keycodes)
+#else
+#    define PROCESS_RECORD_SEQUENCER
+#endif
+#if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
+#    define PROCESS_RECORD_MIDI PROCESS_RECORD_KEYCODES(process_midi, process_midi_keycodes)
+#else
+#    define PROCESS_RECORD_MIDI
+#endif
+#ifdef AUDIO_ENABLE
+#    define PROCESS_RECORD_AUDIO PROCESS_RECORD_KEYCODES(process_audio, process_audio_keycodes)
+#else
+#    define PROCESS_RECORD_AUDIO
+#endif
+#if defined(BACKLIGHT_ENABLE) || defined(LED_MATRIX_ENABLE)
+#    define PROCESS_RECORD_BACKLIGHT PROCESS_RECORD_KEYCODES(process_backlight, process_backlight_keycodes)
+#else
+#    define PROCESS_RECORD_BACKLIGHT
+#endif
+#ifdef STENO_ENABLE
+#    define PROCESS_RECORD_STENO PROCESS_RECORD_KEYCODES(process_steno, process_steno_keycodes)
+#else
+#    define PROCESS_RECORD_STENO
+#endif
+#if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
+#    define PROCESS_RECORD_MUSIC PROCESS_RECORD_OBSERVE_ALL(process_music)
+#else
+#    define PROCESS_RECORD_MUSIC
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+#    define PROCESS_RECORD_KEY_OVERRIDE PROCESS_RECORD_OBSERVE_ALL(process_key_override)
+#else
+#    define PROCESS_RECORD_KEY_OVERRIDE
+#endif
+#ifdef TAP_DANCE_ENABLE
+#    define PROCESS_RECORD_TAP_DANCE PROCESS_RECORD_KEYCODES(process_tap_dance, process_tap_dance_keycodes)
+#else
+#    define PROCESS_RECORD_TAP_DANCE
+#endif
+#ifdef CAPS_WORD_ENABLE
+#    define PROCESS_RECORD_CAPS_WORD PROCESS_RECORD_OBSERVE_ALL(process_caps_word)
+#else
+#    define PROCESS_RECORD_CAPS_WORD
+#endif
+#if defined(UNICODE_COMMON_ENABLE) && defined(UCIS_ENABLE)
+// UCIS captures every key while active
+#    define PROCESS_RECORD_UNICODE_COMMON PROCESS_RECORD_OBSERVE_ALL(process_unicode_common)
+#elif defined(UNICODE_COMMON_ENABLE)
+#    define PROCESS_RECORD_UNICODE_COMMON PROCESS_RECORD_KEYCODES(process_unicode_common, process_unicode_common_keycodes)
+#else
+#    define PROCESS_RECORD_UNICODE_COMMON
+#endif
+#ifdef LEADER_ENABLE
+#    define PROCESS_RECORD_LEADER PROCESS_RECORD_OBSERVE_ALL(process_leader)
+#else
+#    define PROCESS_RECORD_LEADER
+#endif
+#ifdef PRINTING_ENABLE
+#    define PROCESS_RECORD_PRINTER PROCESS_RECORD_OBSERVE_ALL(process_printer)
+#else
+#    define PROCESS_RECORD_PRINTER
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+#    define PROCESS_RECORD_AUTO_SHIFT PROCESS_RECORD_OBSERVE_ALL(process_auto_shift)
+#else
+#    define PROCESS_RECORD_AUTO_SHIFT
+#endif
+#ifdef DYNAMIC_TAPPING_TERM_ENABLE
+#    define PROCESS_RECORD_DYNAMIC_TAPPING_TERM PROCESS_RECORD_KEYCODES(process_dynamic_tapping_term, process_dynamic_tapping_term_keycodes)
+#else
+#    define PROCESS_RECORD_DYNAMIC_TAPPING_TERM
+#endif
+#ifdef SPACE_CADET_ENABLE
+#    define PROCESS_RECORD_SPACE_CADET PROCESS_RECORD_OBSERVE_ALL(process_space_cadet)
+#else
+#    define PROCESS_RECORD_SPACE_CADET
+#endif
+#ifdef MAGIC_KEYCODE_ENABLE
+#    define PROCESS_RECORD_MAGIC PROCESS_RECORD_KEYCODES(process_magic, process_magic_keycodes)
+#else
+#    define PROCESS_RECORD_MAGIC
+#endif
+#ifdef GRAVE_ESC_ENABLE
+#    define PROCESS_RECORD_GRAVE_ESC PROCESS_RECORD_KEYCODES(process_grave_esc, process_grave_esc_keycodes)
+#else
+#    define PROCESS_RECORD_GRAVE_ESC
+#endif
+#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
+#    define PROCESS_RECORD_RGB PROCESS_RECORD_KEYCODES(process_rgb, process_rgb_keycodes)
+#else
+#    define PROCESS_RECORD_RGB
+#endif
+#ifdef JOYSTICK_ENABLE
+#    define PROCESS_RECORD_JOYSTICK PROCESS_RECORD_KEYCODES(process_joystick, process_joystick_keycodes)
+#else
+#    define PROCESS_RECORD_JOYSTICK
+#endif
+#ifdef PROGRAMMABLE_BUTTON_ENABLE
+#    define PROCESS_RECORD_PROGRAMMABLE_BUTTON PROCESS_RECORD_KEYCODES(process_programmable_button, process_programmable_button_keycodes)
+#else
+#    define PROCESS_RECORD_PROGRAMMABLE_BUTTON
+#endif
+
+// clang-format off
+#ifndef PROCESS_RECORD_PIPELINE
+#    define PROCESS_RECORD_PIPELINE \
+        PROCESS_RECORD_DYNAMIC_MACRO \
+        PROCESS_RECORD_CLICKY \
+        PROCESS_RECORD_HAPTIC \
+        PROCESS_RECORD_VIA \
+        PROCESS_RECORD_KB \
+        PROCESS_RECORD_SECURE \
+        PROCESS_RECORD_SEQUENCER \
+        PROCESS_RECORD_MIDI \
+        PROCESS_RECORD_AUDIO \
+        PROCESS_RECORD_BACKLIGHT \
+        PROCESS_RECORD_STENO \
+        PROCESS_RECORD_MUSIC \
+        PROCESS_RECORD_KEY_OVERRIDE \
+        PROCESS_RECORD_TAP_DANCE \
+        PROCESS_RECORD_CAPS_WORD \
+        PROCESS_RECORD_UNICODE_COMMON \
+        PROCESS_RECORD_LEADER \
+        PROCESS_RECORD_PRINTER \
+        PROCESS_RECORD_AUTO_SHIFT \
+        PROCESS_RECORD_DYNAMIC_TAPPING_TERM \
+        PROCESS_RECORD_SPACE_CADET \
+        PROCESS_RECORD_MAGIC \
+        PROCESS_RECORD_GRAVE_ESC \
+        PROCESS_RECORD_RGB \
+        PROCESS_RECORD_JOYSTICK \
+        PROCESS_RECORD_PROGRAMMABLE_BUTTON
+#endif
+
+static const process_record_handler_t process_record_handlers[] PROGMEM = {
+    PROCESS_RECORD_PIPELINE
+};
+// clang-format on
+
+#define PROCESS_RECORD_HANDLER_COUNT (sizeof(process_record_handlers) / sizeof(process_record_handlers[0]))
+
+_Static_assert(PROCESS_RECORD_HANDLER_COUNT <= 32, "Too many process_record handlers in PROCESS_RECORD_PIPELINE");
+
+#ifdef PROCESS_RECORD_DISPATCH_SIZE
+_Static_assert(PROCESS_RECORD_DISPATCH_SIZE <= UINT8_MAX, "PROCESS_RECORD_DISPATCH_SIZE must fit in a uint8_t");
+
+static uint32_t dispatch_observe_all = 0;
+static uint8_t  segment_count        = 0;
+static uint16_t segment_first[PROCESS_RECORD_DISPATCH_SIZE];
+static uint32_t segment_handlers[PROCESS_RECORD_DISPATCH_SIZE];
+
+/**
+ * Inserts a segment starting at the given keycode, keeping the segments sorted.
+ */
+static bool dispatch_add_boundary(uint16_t keycode) {
+    uint8_t i = segment_count;
+    while (i > 0 && segment_first[i - 1] > keycode) {
+        i--;
+    }
+    if (i > 0 && segment_first[i - 1] == keycode) {
+        return true;
+    }
+    if (segment_count == PROCESS_RECORD_DISPATCH_SIZE) {
+        return false;
+    }
+    memmove(&segment_first[i + 1], &segment_first[i], (segment_count - i) * sizeof(segment_first[0]));
+    segment_first[i] = keycode;
+    segment_count++;
+    return true;
+}
+
+void process_record_dispatch_init(void) {
+    dispatch_observe_all = 0;
+    segment_count        = 0;
+    memset(segment_handlers, 0, sizeof(segment_handlers));
+
+    for (uint8_t i = 0; i < PROCESS_RECORD_HANDLER_COUNT; i++) {
+        const process_record_range_t *range = pgm_read_ptr(&process_record_handlers[i].keycodes);
+        if (range == NULL) {
+            dispatch_observe_all |= (uint32_t)1 << i;
+            continue;
+        }
+        for (uint16_t first, last; (first = pgm_read_word(&range->first)) <= (last = pgm_read_word(&range->last)); range++) {
+            if (!dispatch_add_boundary(first) || (last != UINT16_MAX && !dispatch_add_boundary(last + 1))) {
+                dprintf("process_record: dispatch index full, %u observes all keycodes\n", i);
+                dispatch_observe_all |= (uint32_t)1 << i;
+                break;
+            }
+        }
+    }
+
+    // Ranges start and end on segment boundaries, so every segment is either entirely within a range or outside of it
+    for (uint8_t i = 0; i < PROCESS_RECORD_HANDLER_COUNT; i++) {
+        const process_record_range_t *range = pgm_read_ptr(&process_record_handlers[i].keycodes);
+        if (range == NULL || (dispatch_observe_all & ((uint32_t)1 << i))) {
+            continue;
+        }
+        for (uint16_t first, last; (first = pgm_read_word(&range->first)) <= (last = pgm_read_word(&range->last)); range++) {
+            for (uint8_t s = 0; s < segment_count; s++) {
+                if (segment_first[s] >= first && segment_first[s] <= last) {
+                    segment_handlers[s] |= (uint32_t)1 << i;
+                }
+            }
+        }
+    }
+}
+
+static uint32_t dispatch_lookup(uint16_t keycode) {
+    uint8_t low = 0, high = segment_count;
+    // Find the first segment starting after the keycode
+    while (low < high) {
+        uint8_t mid = (low + high) / 2;
+        if (segment_first[mid] <= keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return dispatch_observe_all | (low > 0 ? segment_handlers[low - 1] : 0);
+}
+#else
+static inline uint32_t dispatch_lookup(uint16_t keycode) {
+    return UINT32_MAX >> (32 - PROCESS_RECORD_HANDLER_COUNT);
+}
+#endif // PROCESS_RECORD_DISPATCH_SIZE
+
+bool process_record_dispatch(uint16_t keycode, keyrecord_t *record) {
+    uint32_t handlers = dispatch_lookup(keycode);
+    while (handlers) {
+        uint8_t                     i       = __builtin_ctzl(handlers);
+        process_record_handler_fn_t handler = (process_record_handler_fn_t)pgm_read_ptr(&process_record_handlers[i].handler);
+        if (!handler(keycode, record)) {
+            return false;
+        }
+        handlers &= handlers - 1;
+    }
+    return true;
+}
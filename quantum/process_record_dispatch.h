@@ -0,0 +1,58 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "action.h"
+#include "progmem.h"
+
+/**
+ * @brief Inclusive range of keycodes consumed by a process_record handler.
+ *
+ * Range lists are terminated by PROCESS_RECORD_RANGES_END, and should be
+ * declared PROGMEM.
+ */
+typedef struct {
+    uint16_t first;
+    uint16_t last;
+} process_record_range_t;
+
+#define PROCESS_RECORD_RANGE(first, last) \
+    { (first), (last) }
+#define PROCESS_RECORD_KEYCODE(keycode) \
+    { (keycode), (keycode) }
+#define PROCESS_RECORD_RANGES_END \
+    { UINT16_MAX, 0 }
+
+typedef bool (*process_record_handler_fn_t)(uint16_t keycode, keyrecord_t *record);
+
+/**
+ * @brief A handler in the process_record pipeline.
+ *
+ * Handlers with a list of keycode ranges are only offered events for those
+ * keycodes, handlers without one observe every event.
+ */
+typedef struct {
+    process_record_handler_fn_t   handler;
+    const process_record_range_t *keycodes;
+} process_record_handler_t;
+
+#define PROCESS_RECORD_OBSERVE_ALL(handler) {(handler), NULL},
+#define PROCESS_RECORD_KEYCODES(handler, keycodes) {(handler), (keycodes)},
+
+#ifdef PROCESS_RECORD_DISPATCH_SIZE
+/**
+ * @brief Builds the keycode index from the ranges of the pipeline's handlers.
+ */
+void process_record_dispatch_init(void);
+#endif
+
+/**
+ * @brief Offers the event to every interested handler in pipeline order.
+ *
+ * @return false A handler consumed the event, stop processing.
+ * @return true Continue processing.
+ */
+bool process_record_dispatch(uint16_t keycode, keyrecord_t *record);
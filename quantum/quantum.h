@@ -19,6 +19,7 @@
 #include "wait.h"
 #include "matrix.h"
 #include "keymap.h"
+#include "process_record_dispatch.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -1,48 +1,101 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
 #pragma once
 
-#include <util/atomic.h>
 #include <stdint.h>
 #include <stdbool.h>
 
-#ifndef RBUF_SIZE
-#    define RBUF_SIZE 32
-#endif
+/**
+ * @file ring_buffer.h
+ *
+ * @brief Typed lock-free single-producer/single-consumer ring buffers.
+ *
+ * `RING_BUFFER_DECLARE(name, type, size);` declares the ring type `name_t`
+ * and its static inline accessors `name_init()`, `name_push()`, `name_pop()`,
+ * `name_peek()`, `name_count()`, `name_empty()` and `name_clear()`.
+ *
+ * One context may push while another one pops, e.g. an interrupt handler
+ * handing events to the main loop, without disabling interrupts. The head
+ * index is only written by the producer and the tail index only by the
+ * consumer, and each side publishes its index with release semantics after
+ * it is done with the slot. On Cortex-M this emits the required `dmb`
+ * instructions, on AVR it is a compiler barrier.
+ *
+ * Both indices are free running 8-bit counters so that loading and storing
+ * them is a single instruction on every supported MCU, which limits `size` to
+ * powers of two up to 128. All `size` slots are usable.
+ */
 
-static uint8_t     rbuf[RBUF_SIZE];
-static uint8_t     rbuf_head = 0;
-static uint8_t     rbuf_tail = 0;
-static inline bool rbuf_enqueue(uint8_t data) {
-    bool ret = false;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        uint8_t next = (rbuf_head + 1) % RBUF_SIZE;
-        if (next != rbuf_tail) {
-            rbuf[rbuf_head] = data;
-            rbuf_head       = next;
-            ret             = true;
-        }
-    }
-    return ret;
-}
-static inline uint8_t rbuf_dequeue(void) {
-    uint8_t val = 0;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        if (rbuf_head != rbuf_tail) {
-            val       = rbuf[rbuf_tail];
-            rbuf_tail = (rbuf_tail + 1) % RBUF_SIZE;
-        }
-    }
+#define RING_BUFFER_LOAD_ACQUIRE(index) __atomic_load_n(&(index), __ATOMIC_ACQUIRE)
+#define RING_BUFFER_LOAD_RELAXED(index) __atomic_load_n(&(index), __ATOMIC_RELAXED)
+#define RING_BUFFER_STORE_RELEASE(index, value) __atomic_store_n(&(index), (uint8_t)(value), __ATOMIC_RELEASE)
+
+#ifdef __cplusplus
+#    define RING_BUFFER_STATIC_ASSERT static_assert
+#else
+#    define RING_BUFFER_STATIC_ASSERT _Static_assert
+#endif
 
-    return val;
-}
-static inline bool rbuf_has_data(void) {
-    bool has_data;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        has_data = (rbuf_head != rbuf_tail);
-    }
-    return has_data;
-}
-static inline void rbuf_clear(void) {
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        rbuf_head = rbuf_tail = 0;
-    }
-}
+// clang-format off
+#define RING_BUFFER_DECLARE(name, type, size)                                               \
+    typedef struct {                                                                        \
+        type    data[size];                                                                 \
+        uint8_t head; /* written by the producer only */                                    \
+        uint8_t tail; /* written by the consumer only */                                    \
+    } name##_t;                                                                             \
+                                                                                            \
+    /* Empties the ring, neither side may be using it. */                                   \
+    static inline void name##_init(name##_t *ring) {                                        \
+        ring->head = 0;                                                                     \
+        ring->tail = 0;                                                                     \
+    }                                                                                       \
+                                                                                            \
+    /* Producer side, returns false if the ring is full. */                                 \
+    static inline bool name##_push(name##_t *ring, type value) {                            \
+        uint8_t head = RING_BUFFER_LOAD_RELAXED(ring->head);                                \
+        if ((uint8_t)(head - RING_BUFFER_LOAD_ACQUIRE(ring->tail)) == (size)) {             \
+            return false;                                                                   \
+        }                                                                                   \
+        ring->data[head & ((size)-1)] = value;                                              \
+        RING_BUFFER_STORE_RELEASE(ring->head, head + 1);                                    \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    /* Consumer side, returns false if the ring is empty. */                                \
+    static inline bool name##_peek(name##_t *ring, type *value) {                           \
+        uint8_t tail = RING_BUFFER_LOAD_RELAXED(ring->tail);                                \
+        if (RING_BUFFER_LOAD_ACQUIRE(ring->head) == tail) {                                 \
+            return false;                                                                   \
+        }                                                                                   \
+        *value = ring->data[tail & ((size)-1)];                                             \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    /* Consumer side, returns false if the ring is empty. */                                \
+    static inline bool name##_pop(name##_t *ring, type *value) {                            \
+        if (!name##_peek(ring, value)) {                                                    \
+            return false;                                                                   \
+        }                                                                                   \
+        RING_BUFFER_STORE_RELEASE(ring->tail, RING_BUFFER_LOAD_RELAXED(ring->tail) + 1);    \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    /* Consumer side, drops everything that has been pushed so far. */                      \
+    static inline void name##_clear(name##_t *ring) {                                       \
+        RING_BUFFER_STORE_RELEASE(ring->tail, RING_BUFFER_LOAD_ACQUIRE(ring->head));        \
+    }                                                                                       \
+                                                                                            \
+    /* Either side, a lower bound for the consumer and an upper bound for the producer. */  \
+    static inline uint8_t name##_count(name##_t *ring) {                                    \
+        uint8_t tail = RING_BUFFER_LOAD_ACQUIRE(ring->tail);                                \
+        return (uint8_t)(RING_BUFFER_LOAD_ACQUIRE(ring->head) - tail);                      \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_empty(name##_t *ring) {                                       \
+        return name##_count(ring) == 0;                                                     \
+    }                                                                                       \
+                                                                                            \
+    RING_BUFFER_STATIC_ASSERT((size) > 0 && (size) <= 128 && ((size) & ((size)-1)) == 0,    \
+                              #name " size must be a power of two no larger than 128")
+// clang-format on
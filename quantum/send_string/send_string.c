@@ -142,6 +142,188 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+#ifdef SEND_STRING_ASYNC
+/* Instead of tapping keys and waiting in between, the keys and delays are
+ * queued up and played back from send_string_task(), one report at a time,
+ * so the rest of the keyboard keeps running while a string is being typed.
+ */
+
+#    define SS_OP_REGISTER 0x0000
+#    define SS_OP_UNREGISTER 0x2000
+#    define SS_OP_DELAY 0x4000
+#    define SS_OP_DEL_KEY 0x6000
+#    define SS_OP_MASK 0xE000
+#    define SS_OP_VALUE_MAX 0x1FFF
+
+_Static_assert(SEND_STRING_QUEUE_SIZE <= UINT8_MAX, "SEND_STRING_QUEUE_SIZE must fit in a uint8_t");
+
+static uint16_t ss_queue[SEND_STRING_QUEUE_SIZE];
+static uint8_t  ss_queue_head   = 0;
+static uint8_t  ss_queue_length = 0;
+static uint32_t ss_last_op      = 0;
+static uint16_t ss_wait         = 0;
+
+/** \brief Runs the next queued operation, if it is due.
+ *
+ * \return true if an operation was run.
+ */
+static bool send_string_step(void) {
+    if (!ss_queue_length || timer_elapsed32(ss_last_op) < ss_wait) {
+        return false;
+    }
+
+    uint16_t op, value;
+    do {
+        op            = ss_queue[ss_queue_head];
+        value         = op & SS_OP_VALUE_MAX;
+        ss_queue_head = (ss_queue_head + 1) % SEND_STRING_QUEUE_SIZE;
+        ss_queue_length--;
+
+        // Keys removed from the report go out together with the next operation
+        if ((op & SS_OP_MASK) == SS_OP_DEL_KEY) {
+            del_key(value);
+        }
+    } while ((op & SS_OP_MASK) == SS_OP_DEL_KEY && ss_queue_length);
+
+    switch (op & SS_OP_MASK) {
+        case SS_OP_DEL_KEY:
+            ss_wait = 0;
+            break;
+        case SS_OP_REGISTER:
+            register_code(value);
+            ss_wait = SEND_STRING_ASYNC_INTERVAL_MS;
+            break;
+        case SS_OP_UNREGISTER:
+            unregister_code(value);
+            ss_wait = SEND_STRING_ASYNC_INTERVAL_MS;
+            break;
+        default:
+            ss_wait = value;
+            break;
+    }
+    ss_last_op = timer_read32();
+    return true;
+}
+
+static void send_string_enqueue(uint16_t op) {
+    // Make room by playing back the oldest operations, nothing is ever dropped
+    while (ss_queue_length >= SEND_STRING_QUEUE_SIZE) {
+        if (!send_string_step()) {
+            wait_ms(1);
+        }
+    }
+    ss_queue[(ss_queue_head + ss_queue_length) % SEND_STRING_QUEUE_SIZE] = op;
+    ss_queue_length++;
+}
+
+void send_string_task(void) {
+    send_string_step();
+}
+
+void send_string_flush(void) {
+    while (ss_queue_length) {
+        if (!send_string_step()) {
+            wait_ms(1);
+        }
+    }
+}
+
+bool send_string_is_busy(void) {
+    return ss_queue_length != 0;
+}
+
+static void ss_register(uint8_t keycode) {
+    send_string_enqueue(SS_OP_REGISTER | keycode);
+}
+
+static void ss_unregister(uint8_t keycode) {
+    send_string_enqueue(SS_OP_UNREGISTER | keycode);
+}
+
+#    ifdef SEND_STRING_PACK_REPORTS
+static void ss_del_key(uint8_t keycode) {
+    send_string_enqueue(SS_OP_DEL_KEY | keycode);
+}
+#    endif
+
+static void ss_delay(uint32_t ms) {
+    while (ms) {
+        uint16_t chunk = ms > SS_OP_VALUE_MAX ? SS_OP_VALUE_MAX : ms;
+        send_string_enqueue(SS_OP_DELAY | chunk);
+        ms -= chunk;
+    }
+}
+
+static void ss_tap(uint8_t keycode) {
+    ss_register(keycode);
+    ss_delay(keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+    ss_unregister(keycode);
+}
+#else
+#    define ss_register(keycode) register_code(keycode)
+#    define ss_unregister(keycode) unregister_code(keycode)
+#    define ss_tap(keycode) tap_code(keycode)
+#    define ss_del_key(keycode) del_key(keycode)
+
+static void ss_delay(uint32_t ms) {
+    while (ms--)
+        wait_ms(1);
+}
+#endif
+
+#ifdef SEND_STRING_PACK_REPORTS
+/* Rather than sending a release report after every character, the last key
+ * is held until the next one is pressed, and released in that same report.
+ * Only a repeated key, or a change of modifiers, needs a report of its own.
+ */
+
+static uint8_t ss_held_keycode = KC_NO;
+static bool    ss_held_shifted = false;
+static bool    ss_held_altgred = false;
+
+static void ss_release_held(void) {
+    if (ss_held_keycode == KC_NO) {
+        return;
+    }
+
+    ss_unregister(ss_held_keycode);
+    if (ss_held_altgred) {
+        ss_unregister(KC_RIGHT_ALT);
+    }
+    if (ss_held_shifted) {
+        ss_unregister(KC_LEFT_SHIFT);
+    }
+    ss_held_keycode = KC_NO;
+}
+
+static void ss_press_packed(uint8_t keycode, bool is_shifted, bool is_altgred) {
+    if (keycode == ss_held_keycode || is_shifted != ss_held_shifted || is_altgred != ss_held_altgred) {
+        ss_release_held();
+    }
+
+    if (ss_held_keycode == KC_NO) {
+        if (is_shifted) {
+            ss_register(KC_LEFT_SHIFT);
+        }
+        if (is_altgred) {
+            ss_register(KC_RIGHT_ALT);
+        }
+    } else {
+        ss_del_key(ss_held_keycode);
+    }
+    ss_register(keycode);
+    ss_delay(TAP_CODE_DELAY);
+
+    ss_held_keycode = keycode;
+    ss_held_shifted = is_shifted;
+    ss_held_altgred = is_altgred;
+}
+#else
+#    define ss_release_held()
+#endif
+
+static void ss_send_char(char ascii_code);
+
 void send_string(const char *string) {
     send_string_with_delay(string, 0);
 }
@@ -151,19 +333,20 @@ void send_string_with_delay(const char *string, uint8_t interval) {
         char ascii_code = *string;
         if (!ascii_code) break;
         if (ascii_code == SS_QMK_PREFIX) {
+            ss_release_held();
             ascii_code = *(++string);
             if (ascii_code == SS_TAP_CODE) {
                 // tap
                 uint8_t keycode = *(++string);
-                tap_code(keycode);
+                ss_tap(keycode);
             } else if (ascii_code == SS_DOWN_CODE) {
                 // down
                 uint8_t keycode = *(++string);
-                register_code(keycode);
+                ss_register(keycode);
             } else if (ascii_code == SS_UP_CODE) {
                 // up
                 uint8_t keycode = *(++string);
-                unregister_code(keycode);
+                ss_unregister(keycode);
             } else if (ascii_code == SS_DELAY_CODE) {
                 // delay
                 int     ms      = 0;
@@ -173,23 +356,27 @@ void send_string_with_delay(const char *string, uint8_t interval) {
                     ms += keycode - '0';
                     keycode = *(++string);
                 }
-                while (ms--)
-                    wait_ms(1);
+                ss_delay(ms);
             }
         } else {
-            send_char(ascii_code);
+            ss_send_char(ascii_code);
         }
         ++string;
         // interval
-        {
-            uint8_t ms = interval;
-            while (ms--)
-                wait_ms(1);
+        if (interval) {
+            ss_release_held();
+            ss_delay(interval);
         }
     }
+    ss_release_held();
 }
 
 void send_char(char ascii_code) {
+    ss_send_char(ascii_code);
+    ss_release_held();
+}
+
+static void ss_send_char(char ascii_code) {
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
     if (ascii_code == '\a') { // BEL
         PLAY_SONG(bell_song);
@@ -202,21 +389,29 @@ void send_char(char ascii_code) {
     bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
     bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
 
+#ifdef SEND_STRING_PACK_REPORTS
+    if (IS_KEY(keycode) && keycode != KC_CAPS_LOCK && !is_dead) {
+        ss_press_packed(keycode, is_shifted, is_altgred);
+        return;
+    }
+    ss_release_held();
+#endif
+
     if (is_shifted) {
-        register_code(KC_LEFT_SHIFT);
+        ss_register(KC_LEFT_SHIFT);
     }
     if (is_altgred) {
-        register_code(KC_RIGHT_ALT);
+        ss_register(KC_RIGHT_ALT);
     }
-    tap_code(keycode);
+    ss_tap(keycode);
     if (is_altgred) {
-        unregister_code(KC_RIGHT_ALT);
+        ss_unregister(KC_RIGHT_ALT);
     }
     if (is_shifted) {
-        unregister_code(KC_LEFT_SHIFT);
+        ss_unregister(KC_LEFT_SHIFT);
     }
     if (is_dead) {
-        tap_code(KC_SPACE);
+        ss_tap(KC_SPACE);
     }
 }
 
@@ -284,19 +479,20 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
         char ascii_code = pgm_read_byte(string);
         if (!ascii_code) break;
         if (ascii_code == SS_QMK_PREFIX) {
+            ss_release_held();
             ascii_code = pgm_read_byte(++string);
             if (ascii_code == SS_TAP_CODE) {
                 // tap
                 uint8_t keycode = pgm_read_byte(++string);
-                tap_code(keycode);
+                ss_tap(keycode);
             } else if (ascii_code == SS_DOWN_CODE) {
                 // down
                 uint8_t keycode = pgm_read_byte(++string);
-                register_code(keycode);
+                ss_register(keycode);
             } else if (ascii_code == SS_UP_CODE) {
                 // up
                 uint8_t keycode = pgm_read_byte(++string);
-                unregister_code(keycode);
+                ss_unregister(keycode);
             } else if (ascii_code == SS_DELAY_CODE) {
                 // delay
                 int     ms      = 0;
@@ -306,19 +502,18 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
                     ms += keycode - '0';
                     keycode = pgm_read_byte(++string);
                 }
-                while (ms--)
-                    wait_ms(1);
+                ss_delay(ms);
             }
         } else {
-            send_char(ascii_code);
+            ss_send_char(ascii_code);
         }
         ++string;
         // interval
-        {
-            uint8_t ms = interval;
-            while (ms--)
-                wait_ms(1);
+        if (interval) {
+            ss_release_held();
+            ss_delay(interval);
         }
     }
+    ss_release_held();
 }
 #endif
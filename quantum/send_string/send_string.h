@@ -22,6 +22,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
@@ -149,4 +150,34 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 #define SEND_STRING_DELAY(string, interval) send_string_with_delay_P(PSTR(string), interval)
 
+#if defined(SEND_STRING_ASYNC) || defined(__DOXYGEN__)
+#    ifndef SEND_STRING_QUEUE_SIZE
+#        define SEND_STRING_QUEUE_SIZE 64
+#    endif
+#    ifndef SEND_STRING_ASYNC_INTERVAL_MS
+#        define SEND_STRING_ASYNC_INTERVAL_MS 1
+#    endif
+
+/**
+ * \brief Plays back the next queued keystroke, once it is due.
+ *
+ * Called from the main loop when `SEND_STRING_ASYNC` is defined.
+ */
+void send_string_task(void);
+
+/**
+ * \brief Blocks until every queued keystroke has been sent.
+ *
+ * Use this before registering keys directly, if they have to come after a string that is still being typed.
+ */
+void send_string_flush(void);
+
+/**
+ * \brief Checks whether a string is still being typed out.
+ *
+ * \return true if there are queued keystrokes left.
+ */
+bool send_string_is_busy(void);
+#endif
+
 /** \} */
@@ -5,6 +5,7 @@
 #include <stdlib.h>
 
 #include "matrix.h"
+#include "keyboard.h"
 
 extern volatile bool isLeftHand;
 
@@ -14,3 +15,8 @@ void split_post_init(void);
 
 bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 bool is_transport_connected(void);
+
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_MATRIX_EVENTS)
+// Replaces the time of a slave half key event with the time the slave saw it
+void split_matrix_event_time(keyevent_t *event);
+#endif
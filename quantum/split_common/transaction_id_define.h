@@ -21,9 +21,19 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+    PUT_GET_BATCH,
+#endif // SPLIT_TRANSACTIONS_BATCHED
+
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_MATRIX_EVENTS
+    GET_SLAVE_MATRIX_EVENTS_CHECKSUM,
+    GET_SLAVE_MATRIX_EVENTS_DATA,
+    PUT_SLAVE_MATRIX_EVENTS_ACK,
+#endif // SPLIT_MATRIX_EVENTS
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -29,10 +29,20 @@
 
 #define SYNC_TIMER_OFFSET 2
 
+extern uint8_t thatHand;
+
 #ifndef FORCED_SYNC_THROTTLE_MS
 #    define FORCED_SYNC_THROTTLE_MS 100
 #endif // FORCED_SYNC_THROTTLE_MS
 
+#ifndef SPLIT_SYNC_KEEPALIVE_MAX_MS
+#    define SPLIT_SYNC_KEEPALIVE_MAX_MS (FORCED_SYNC_THROTTLE_MS * 16)
+#endif // SPLIT_SYNC_KEEPALIVE_MAX_MS
+
+#ifndef SPLIT_SYNC_OPPORTUNISTIC_MAX_DELAY_MS
+#    define SPLIT_SYNC_OPPORTUNISTIC_MAX_DELAY_MS FORCED_SYNC_THROTTLE_MS
+#endif // SPLIT_SYNC_OPPORTUNISTIC_MAX_DELAY_MS
+
 #define sizeof_member(type, member) sizeof(((type *)NULL)->member)
 
 #define trans_initiator2target_initializer_cb(member, cb) \
@@ -83,14 +93,274 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
-inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
+////////////////////////////////////////////////////
+// Batching
+
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+
+// Marks the end of the records in an initiator->target batch frame
+#    define SPLIT_BATCH_END 0xFF
+
+#    if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+#        define SPLIT_BATCH_LAST_ID PUT_RPC_INFO
+#    else
+#        define SPLIT_BATCH_LAST_ID NUM_TOTAL_TRANSACTIONS
+#    endif
+
+void slave_batch_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+
+static uint32_t batch_dirty   = 0; // initiator->target payloads waiting for the next frame
+static uint32_t batch_s2m_ids = 0; // target->initiator payloads carried by every response
+
+static inline bool is_batchable(int8_t id) {
+    // Only QMK core sync data is batched, RPC keeps its own sequence of transactions
+    return id > PUT_GET_BATCH && id < SPLIT_BATCH_LAST_ID;
+}
+
+static void batch_prepare(void) {
+    static bool prepared = false;
+    if (prepared) return;
+
+    // Both sides derive the response layout from the same table, so it never has to be sent
+    uint8_t length = 0;
+    for (int8_t id = PUT_GET_BATCH + 1; id < SPLIT_BATCH_LAST_ID; ++id) {
+        uint8_t size = split_transaction_table[id].target2initiator_buffer_size;
+        if (size && !split_transaction_table[id].slave_callback && length + size <= SPLIT_BATCH_S2M_BUFFER_SIZE) {
+            batch_s2m_ids |= (1UL << id);
+            length += size;
+        }
+    }
+    split_transaction_table[PUT_GET_BATCH].target2initiator_buffer_size = sizeof_member(split_batch_s2m_t, checksum) + sizeof_member(split_batch_s2m_t, ack) + length;
+    prepared = true;
+}
+
+static bool batch_write(int8_t id, const void *data, size_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (!is_batchable(id) || sizeof(int8_t) + trans->initiator2target_buffer_size > SPLIT_BATCH_M2S_BUFFER_SIZE) {
+        return transport_write(id, data, length);
+    }
+
+    // Stage the payload where the transport would have put it, it goes out with the next frame
+    size_t len = trans->initiator2target_buffer_size < length ? trans->initiator2target_buffer_size : length;
+    memcpy(split_trans_initiator2target_buffer(trans), data, len);
+    batch_dirty |= (1UL << id);
+    return true;
+}
+
+static bool batch_read(int8_t id, void *data, size_t length) {
+    if (!(batch_s2m_ids & (1UL << id))) {
+        return transport_read(id, data, length);
+    }
+
+    // Already received with this scan's frame
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    size_t                    len   = trans->target2initiator_buffer_size < length ? trans->target2initiator_buffer_size : length;
+    memcpy(data, split_trans_target2initiator_buffer(trans), len);
+    return true;
+}
+
+static inline bool is_batch_urgent(int8_t id) {
+    // Key handling on the target depends on these, so they never wait behind lighting or display payloads
+    switch (id) {
+#    if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+        case PUT_LAYER_STATE:
+        case PUT_DEFAULT_LAYER_STATE:
+#    endif // !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
+#    ifdef SPLIT_LED_STATE_ENABLE
+        case PUT_LED_STATE:
+#    endif // SPLIT_LED_STATE_ENABLE
+#    ifdef SPLIT_MODS_ENABLE
+        case PUT_MODS:
+#    endif // SPLIT_MODS_ENABLE
+            return true;
+        default:
+            return false;
+    }
+}
+
+static uint8_t *batch_pack(uint8_t *cursor, const uint8_t *end, bool urgent, uint32_t *sent) {
+    for (int8_t id = PUT_GET_BATCH + 1; id < SPLIT_BATCH_LAST_ID; ++id) {
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (!(batch_dirty & (1UL << id)) || is_batch_urgent(id) != urgent || cursor + sizeof(int8_t) + trans->initiator2target_buffer_size > end) {
+            // Anything that doesn't fit stays dirty for the next frame
+            continue;
+        }
+#    ifndef DISABLE_SYNC_TIMER
+        if (id == PUT_SYNC_TIMER) {
+            // Staged on the previous scan, so restamp it or the target's timer would be set into the past
+            uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
+            memcpy(split_trans_initiator2target_buffer(trans), &sync_timer, sizeof(sync_timer));
+        }
+#    endif // DISABLE_SYNC_TIMER
+        *cursor++ = id;
+        memcpy(cursor, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        cursor += trans->initiator2target_buffer_size;
+        *sent |= (1UL << id);
+    }
+    return cursor;
+}
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t seq = 0;
+    batch_prepare();
+
+    split_batch_m2s_t frame;
+    uint32_t          sent   = 0;
+    uint8_t *         cursor = frame.buffer;
+    uint8_t *         end    = frame.buffer + sizeof(frame.buffer);
+    memset(frame.buffer, SPLIT_BATCH_END, sizeof(frame.buffer));
+    cursor = batch_pack(cursor, end, true, &sent);
+    cursor = batch_pack(cursor, end, false, &sent);
+    // Zero is never sent, so a target that has not accepted a frame yet never acknowledges one
+    if (++seq == 0) {
+        seq = 1;
+    }
+    frame.seq      = seq;
+    frame.checksum = crc8(&frame.seq, sizeof(frame.seq) + sizeof(frame.buffer));
+
+    split_batch_s2m_t response;
+    uint8_t           response_length = split_transaction_table[PUT_GET_BATCH].target2initiator_buffer_size - sizeof(response.checksum) - sizeof(response.ack);
+    if (!transport_execute_transaction(PUT_GET_BATCH, &frame, sizeof(frame), &response, sizeof(response.checksum) + sizeof(response.ack) + response_length)) {
+        return false;
+    }
+    if (response.checksum != crc8(&response.ack, sizeof(response.ack) + response_length)) {
+        return false;
+    }
+    // The target drops frames that fail their checksum, so the payloads stay dirty until it has acknowledged them
+    if (response.ack == frame.seq) {
+        batch_dirty &= ~sent;
+    }
+
+    // Unpack the response where the individual reads would have put it
+    cursor = response.buffer;
+    for (int8_t id = PUT_GET_BATCH + 1; id < SPLIT_BATCH_LAST_ID; ++id) {
+        if (batch_s2m_ids & (1UL << id)) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            memcpy(split_trans_target2initiator_buffer(trans), cursor, trans->target2initiator_buffer_size);
+            cursor += trans->target2initiator_buffer_size;
+        }
+    }
+    return true;
+}
+
+void slave_batch_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    // Ignore the args -- the `split_shmem` already has the frame, and the response has to be built in place.
+    batch_prepare();
+
+    split_batch_sync_t *batch = &split_shmem->batch;
+    if (crc8(&batch->m2s.seq, sizeof(batch->m2s.seq) + sizeof(batch->m2s.buffer)) == batch->m2s.checksum) {
+        batch->s2m.ack        = batch->m2s.seq;
+        const uint8_t *cursor = batch->m2s.buffer;
+        const uint8_t *end    = batch->m2s.buffer + sizeof(batch->m2s.buffer);
+        while (cursor < end && *cursor != SPLIT_BATCH_END) {
+            int8_t id = *cursor++;
+            if (!is_batchable(id)) break;
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            if (cursor + trans->initiator2target_buffer_size > end) break;
+            memcpy(split_trans_initiator2target_buffer(trans), cursor, trans->initiator2target_buffer_size);
+            cursor += trans->initiator2target_buffer_size;
+        }
+    }
+
+    // Always answer with the current target->initiator payloads
+    uint8_t *cursor = batch->s2m.buffer;
+    for (int8_t id = PUT_GET_BATCH + 1; id < SPLIT_BATCH_LAST_ID; ++id) {
+        if (batch_s2m_ids & (1UL << id)) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            memcpy(cursor, split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size);
+            cursor += trans->target2initiator_buffer_size;
+        }
+    }
+    batch->s2m.checksum = crc8(&batch->s2m.ack, cursor - &batch->s2m.ack);
+}
+
+#    define handler_write(id, data, length) batch_write(id, data, length)
+#    define handler_read(id, data, length) batch_read(id, data, length)
+
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS [PUT_GET_BATCH] = {sizeof_member(split_shared_memory_t, batch.m2s), offsetof(split_shared_memory_t, batch.m2s), 0, offsetof(split_shared_memory_t, batch.s2m), slave_batch_callback},
+
+#else // SPLIT_TRANSACTIONS_BATCHED
+
+#    define handler_write(id, data, length) transport_write(id, data, length)
+#    define handler_read(id, data, length) transport_read(id, data, length)
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSACTIONS_BATCHED
+
+////////////////////////////////////////////////////
+// Scheduling
+
+typedef enum {
+    SYNC_REALTIME,      // matrix and timing data: sent on change, keep-alives at a fixed rate
+    SYNC_ON_CHANGE,     // state: sent on change, keep-alives back off while it stays the same
+    SYNC_OPPORTUNISTIC, // frequently changing, cosmetic data: sent on change once the bus is otherwise idle
+} sync_class_t;
+
+typedef struct {
+    sync_class_t sync_class;
+    uint32_t     last_update;
+    uint32_t     keepalive;
+    uint32_t     pending_since;
+    bool         pending;
+} sync_schedule_t;
+
+#define SYNC_SCHEDULE(type) \
+    { .sync_class = type, .last_update = 0, .keepalive = FORCED_SYNC_THROTTLE_MS, .pending_since = 0, .pending = false }
+
+static uint8_t scan_transfers          = 0;     // payloads transferred during the current scan
+static bool    scan_opportunistic_sent = false; // only one opportunistic payload per scan
+
+static void sync_scan_start(void) {
+    scan_transfers          = 0;
+    scan_opportunistic_sent = false;
+}
+
+static bool sync_is_due(sync_schedule_t *schedule, bool changed) {
+    bool keepalive_due = timer_elapsed32(schedule->last_update) >= schedule->keepalive;
+    if (schedule->sync_class != SYNC_OPPORTUNISTIC) {
+        return changed || keepalive_due;
+    }
+
+    if (changed && !schedule->pending) {
+        schedule->pending       = true;
+        schedule->pending_since = timer_read32();
+    }
+    if (!schedule->pending && !keepalive_due) {
+        return false;
+    }
+    // Anything else that had to be transferred this scan goes first, unless this has been waiting too long
+    bool bus_idle = !scan_transfers && !scan_opportunistic_sent;
+    return bus_idle || (schedule->pending && timer_elapsed32(schedule->pending_since) >= SPLIT_SYNC_OPPORTUNISTIC_MAX_DELAY_MS);
+}
+
+static void sync_done(sync_schedule_t *schedule, bool changed) {
+    schedule->last_update = timer_read32();
+    if (changed || schedule->pending || schedule->sync_class == SYNC_REALTIME) {
+        schedule->keepalive = FORCED_SYNC_THROTTLE_MS;
+    } else if (schedule->keepalive < SPLIT_SYNC_KEEPALIVE_MAX_MS) {
+        schedule->keepalive = MIN(schedule->keepalive * 2, SPLIT_SYNC_KEEPALIVE_MAX_MS);
+    }
+    schedule->pending = false;
+
+    if (schedule->sync_class == SYNC_OPPORTUNISTIC) {
+        scan_opportunistic_sent = true;
+    } else {
+        scan_transfers++;
+    }
+}
+
+inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, sync_schedule_t *schedule, void *destination, const void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
-    bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
-    if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
-        okay &= transport_read(trans_id_retrieve, destination, length);
+    bool    okay    = handler_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
+    bool    changed = okay && curr_checksum != crc8(equiv_shmem, length);
+    if (okay && sync_is_due(schedule, changed)) {
+        okay &= handler_read(trans_id_retrieve, destination, length);
         okay &= curr_checksum == crc8(equiv_shmem, length);
         if (okay) {
-            *last_update = timer_read32();
+            sync_done(schedule, changed);
         }
     } else {
         memcpy(destination, equiv_shmem, length);
@@ -98,31 +368,33 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
     return okay;
 }
 
-inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
+inline static bool send_if_condition(int8_t trans_id, sync_schedule_t *schedule, bool condition, void *source, size_t length) {
     bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+    if (sync_is_due(schedule, condition)) {
+        okay &= handler_write(trans_id, source, length);
         if (okay) {
-            *last_update = timer_read32();
+            sync_done(schedule, condition);
         }
     }
     return okay;
 }
 
-inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update, void *source, const void *equiv_shmem, size_t length) {
+inline static bool send_if_data_mismatch(int8_t trans_id, sync_schedule_t *schedule, void *source, const void *equiv_shmem, size_t length) {
     // Just run a memcmp to compare the source and equivalent shmem location
-    return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
+    return send_if_condition(trans_id, schedule, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifndef SPLIT_MATRIX_EVENTS
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update                    = 0;
-    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
-    matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
+    static sync_schedule_t schedule                       = SYNC_SCHEDULE(SYNC_REALTIME);
+    static matrix_row_t    last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
+    matrix_row_t           temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
 
-    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &schedule, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
     if (okay) {
         // Checksum matches the received data, save as the last matrix state
         memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
@@ -138,21 +410,200 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
+#else // SPLIT_MATRIX_EVENTS
+
+_Static_assert((SPLIT_MATRIX_EVENTS_QUEUE_SIZE & (SPLIT_MATRIX_EVENTS_QUEUE_SIZE - 1)) == 0 && SPLIT_MATRIX_EVENTS_QUEUE_SIZE <= 128, "SPLIT_MATRIX_EVENTS_QUEUE_SIZE must be a power of two, no larger than 128");
+_Static_assert(SPLIT_MATRIX_EVENTS_WINDOW <= SPLIT_MATRIX_EVENTS_QUEUE_SIZE, "SPLIT_MATRIX_EVENTS_WINDOW must not exceed SPLIT_MATRIX_EVENTS_QUEUE_SIZE");
+
+// Slave: key changes waiting to be acknowledged by the master, indexed by sequence number
+static split_slave_event_t slave_events[SPLIT_MATRIX_EVENTS_QUEUE_SIZE];
+static uint8_t             slave_events_first_seq = 0;
+static uint8_t             slave_events_count     = 0;
+static uint8_t             slave_events_epoch     = 0;
+
+// Master: received key changes not yet applied to the matrix, and the ones applied this scan
+static split_slave_event_t master_events[SPLIT_MATRIX_EVENTS_QUEUE_SIZE];
+static uint8_t             master_events_count = 0;
+static split_slave_event_t applied_events[SPLIT_MATRIX_EVENTS_QUEUE_SIZE];
+static uint8_t             applied_events_count = 0;
+
+static bool read_slave_matrix_snapshot(__typeof__(split_shmem->sevents.snapshot.payload) *destination) {
+    uint8_t checksum;
+
+    bool okay = handler_read(GET_SLAVE_MATRIX_CHECKSUM, &checksum, sizeof(checksum));
+    okay      = okay && handler_read(GET_SLAVE_MATRIX_DATA, destination, sizeof(*destination));
+    return okay && checksum == crc8(destination, sizeof(*destination));
+}
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static sync_schedule_t schedule                       = SYNC_SCHEDULE(SYNC_REALTIME);
+    static sync_schedule_t ack_schedule                   = SYNC_SCHEDULE(SYNC_REALTIME);
+    static uint8_t         expected_seq                   = 0;
+    static uint8_t         epoch                          = 0;
+    static matrix_row_t    last_matrix[(MATRIX_ROWS) / 2] = {0};
+
+    applied_events_count = 0;
+
+    __typeof__(split_shmem->sevents.payload) window;
+    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_EVENTS_CHECKSUM, GET_SLAVE_MATRIX_EVENTS_DATA, &schedule, &window, &split_shmem->sevents.payload, sizeof(window));
+    if (okay) {
+        if (window.epoch != epoch || (int8_t)(window.first_seq - expected_seq) > 0) {
+            // Events were lost, restart from the current state of the slave half. The snapshot carries the sequence
+            // number it is current up to, so changes queued after the window was read are still picked up.
+            __typeof__(split_shmem->sevents.snapshot.payload) snapshot;
+            okay = read_slave_matrix_snapshot(&snapshot);
+            if (okay) {
+                memcpy(last_matrix, snapshot.matrix, sizeof(last_matrix));
+                master_events_count = 0;
+                expected_seq        = snapshot.end_seq;
+                epoch               = snapshot.epoch;
+            }
+        } else {
+            for (uint8_t i = 0; i < window.count && master_events_count < SPLIT_MATRIX_EVENTS_QUEUE_SIZE; ++i) {
+                uint8_t seq = window.first_seq + i;
+                if (seq != expected_seq) {
+                    // Already received with an earlier window
+                    continue;
+                }
+                master_events[master_events_count++] = window.events[i];
+                expected_seq++;
+            }
+        }
+    }
+
+    // Acknowledge what we have, the slave retransmits anything else
+    if (okay) {
+        okay = send_if_condition(PUT_SLAVE_MATRIX_EVENTS_ACK, &ack_schedule, (expected_seq != split_shmem->sevents.ack), &expected_seq, sizeof(expected_seq));
+    }
+
+    // Apply events in order, but only one change per key each scan so none of them get merged away
+    matrix_row_t changed[(MATRIX_ROWS) / 2] = {0};
+    uint8_t      applied                    = 0;
+    for (; applied < master_events_count; ++applied) {
+        split_slave_event_t *event = &master_events[applied];
+        if (event->row >= (MATRIX_ROWS) / 2 || event->col >= MATRIX_COLS) {
+            // Drop it, not a key of the slave half
+            continue;
+        }
+        matrix_row_t mask = (matrix_row_t)1 << event->col;
+        if (changed[event->row] & mask) {
+            break;
+        }
+        changed[event->row] |= mask;
+        if (event->pressed) {
+            last_matrix[event->row] |= mask;
+        } else {
+            last_matrix[event->row] &= ~mask;
+        }
+        applied_events[applied_events_count++] = *event;
+    }
+    master_events_count -= applied;
+    memmove(master_events, &master_events[applied], master_events_count * sizeof(split_slave_event_t));
+
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+
+static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0};
+
+    // Drop everything the master has acknowledged
+    uint8_t acked = split_shmem->sevents.ack - slave_events_first_seq;
+    if (acked <= slave_events_count) {
+        slave_events_first_seq += acked;
+        slave_events_count -= acked;
+    } else if ((int8_t)acked > 0) {
+        // The master expects events we never sent, e.g. we have been reset
+        slave_events_epoch++;
+    }
+
+    // Queue up the changes since the last scan
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; ++row) {
+        matrix_row_t changes = slave_matrix[row] ^ last_matrix[row];
+        for (uint8_t col = 0; changes; ++col, changes >>= 1) {
+            if (!(changes & 1)) {
+                continue;
+            }
+            if (slave_events_count == SPLIT_MATRIX_EVENTS_QUEUE_SIZE) {
+                // Overflow, the master has to resync from the matrix snapshot
+                slave_events_first_seq += slave_events_count;
+                slave_events_count = 0;
+                slave_events_epoch++;
+            }
+            uint8_t seq                                                      = slave_events_first_seq + slave_events_count++;
+            slave_events[seq & (SPLIT_MATRIX_EVENTS_QUEUE_SIZE - 1)] = (split_slave_event_t){
+                .time    = sync_timer_read() | 1,
+                .row     = row,
+                .col     = col,
+                .pressed = (slave_matrix[row] >> col) & 1,
+            };
+        }
+    }
+    memcpy(last_matrix, slave_matrix, sizeof(last_matrix));
+
+    // Publish the oldest unacknowledged events
+    split_shmem->sevents.payload.epoch     = slave_events_epoch;
+    split_shmem->sevents.payload.first_seq = slave_events_first_seq;
+    split_shmem->sevents.payload.count     = MIN(slave_events_count, SPLIT_MATRIX_EVENTS_WINDOW);
+    for (uint8_t i = 0; i < split_shmem->sevents.payload.count; ++i) {
+        split_shmem->sevents.payload.events[i] = slave_events[(uint8_t)(slave_events_first_seq + i) & (SPLIT_MATRIX_EVENTS_QUEUE_SIZE - 1)];
+    }
+    split_shmem->sevents.checksum = crc8(&split_shmem->sevents.payload, sizeof(split_shmem->sevents.payload));
+
+    // The snapshot is still needed to resync
+    split_shmem->sevents.snapshot.payload.epoch   = slave_events_epoch;
+    split_shmem->sevents.snapshot.payload.end_seq = slave_events_first_seq + slave_events_count;
+    memcpy(split_shmem->sevents.snapshot.payload.matrix, slave_matrix, sizeof(split_shmem->sevents.snapshot.payload.matrix));
+    split_shmem->sevents.snapshot.checksum = crc8(&split_shmem->sevents.snapshot.payload, sizeof(split_shmem->sevents.snapshot.payload));
+}
+
+void split_matrix_event_time(keyevent_t *event) {
+#    ifndef DISABLE_SYNC_TIMER
+    if (event->key.row < thatHand || event->key.row >= thatHand + (MATRIX_ROWS) / 2) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < applied_events_count; ++i) {
+        split_slave_event_t *applied = &applied_events[i];
+        if (applied->row == event->key.row - thatHand && applied->col == event->key.col && applied->pressed == event->pressed) {
+            // Use the time the key actually changed on the slave, unless clock skew puts it in the future
+            if (TIMER_DIFF_16(event->time, applied->time) < 0x8000) {
+                event->time = applied->time;
+            }
+            return;
+        }
+    }
+#    endif // DISABLE_SYNC_TIMER
+}
+
+// clang-format off
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+    [GET_SLAVE_MATRIX_CHECKSUM]        = trans_target2initiator_initializer(sevents.snapshot.checksum), \
+    [GET_SLAVE_MATRIX_DATA]            = trans_target2initiator_initializer(sevents.snapshot.payload), \
+    [GET_SLAVE_MATRIX_EVENTS_CHECKSUM] = trans_target2initiator_initializer(sevents.checksum), \
+    [GET_SLAVE_MATRIX_EVENTS_DATA]     = trans_target2initiator_initializer(sevents.payload), \
+    [PUT_SLAVE_MATRIX_EVENTS_ACK]      = trans_initiator2target_initializer(sevents.ack),
+// clang-format on
+
+#endif // SPLIT_MATRIX_EVENTS
+
 ////////////////////////////////////////////////////
 // Master matrix
 
 #ifdef SPLIT_TRANSPORT_MIRROR
 
 static bool master_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    return send_if_data_mismatch(PUT_MASTER_MATRIX, &last_update, master_matrix, split_shmem->mmatrix.matrix, sizeof(split_shmem->mmatrix.matrix));
+    static sync_schedule_t schedule = SYNC_SCHEDULE(SYNC_REALTIME);
+    return send_if_data_mismatch(PUT_MASTER_MATRIX, &schedule, master_matrix, split_shmem->mmatrix.matrix, sizeof(split_shmem->mmatrix.matrix));
 }
 
 static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -178,10 +629,10 @@ static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_ro
 #ifdef ENCODER_ENABLE
 
 static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         temp_state[NUM_ENCODERS_MAX_PER_SIDE];
+    static sync_schedule_t schedule = SYNC_SCHEDULE(SYNC_ON_CHANGE);
+    uint8_t                temp_state[NUM_ENCODERS_MAX_PER_SIDE];
 
-    bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, temp_state, split_shmem->encoders.state, sizeof(temp_state));
+    bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &schedule, temp_state, split_shmem->encoders.state, sizeof(temp_state));
     if (okay) encoder_update_raw(temp_state);
     return okay;
 }
@@ -217,14 +668,14 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
 #ifndef DISABLE_SYNC_TIMER
 
 static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
+    static sync_schedule_t schedule = SYNC_SCHEDULE(SYNC_REALTIME);
 
     bool okay = true;
-    if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
+    if (sync_is_due(&schedule, false)) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+        okay &= handler_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
         if (okay) {
-            last_update = timer_read32();
+            sync_done(&schedule, false);
         }
     }
     return okay;
@@ -256,12 +707,12 @@ static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 
 static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_layer_state_update         = 0;
-    static uint32_t last_default_layer_state_update = 0;
+    static sync_schedule_t layer_state_schedule         = SYNC_SCHEDULE(SYNC_ON_CHANGE);
+    static sync_schedule_t default_layer_state_schedule = SYNC_SCHEDULE(SYNC_ON_CHANGE);
 
-    bool okay = send_if_condition(PUT_LAYER_STATE, &last_layer_state_update, (layer_state != split_shmem->layers.layer_state), &layer_state, sizeof(layer_state));
+    bool okay = send_if_condition(PUT_LAYER_STATE, &layer_state_schedule, (layer_state != split_shmem->layers.layer_state), &layer_state, sizeof(layer_state));
     if (okay) {
-        okay &= send_if_condition(PUT_DEFAULT_LAYER_STATE, &last_default_layer_state_update, (default_layer_state != split_shmem->layers.default_layer_state), &default_layer_state, sizeof(default_layer_state));
+        okay &= send_if_condition(PUT_DEFAULT_LAYER_STATE, &default_layer_state_schedule, (default_layer_state != split_shmem->layers.default_layer_state), &default_layer_state, sizeof(default_layer_state));
     }
     return okay;
 }
@@ -293,9 +744,9 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 #ifdef SPLIT_LED_STATE_ENABLE
 
 static bool led_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         led_state   = host_keyboard_leds();
-    return send_if_data_mismatch(PUT_LED_STATE, &last_update, &led_state, &split_shmem->led_state, sizeof(led_state));
+    static sync_schedule_t schedule  = SYNC_SCHEDULE(SYNC_ON_CHANGE);
+    uint8_t                led_state = host_keyboard_leds();
+    return send_if_data_mismatch(PUT_LED_STATE, &schedule, &led_state, &split_shmem->led_state, sizeof(led_state));
 }
 
 static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -321,31 +772,31 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #ifdef SPLIT_MODS_ENABLE
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t   last_update    = 0;
-    bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
-    split_mods_sync_t new_mods;
+    static sync_schedule_t schedule     = SYNC_SCHEDULE(SYNC_ON_CHANGE);
+    bool                   mods_changed = false;
+    split_mods_sync_t      new_mods;
     new_mods.real_mods = get_mods();
-    if (!mods_need_sync && new_mods.real_mods != split_shmem->mods.real_mods) {
-        mods_need_sync = true;
+    if (new_mods.real_mods != split_shmem->mods.real_mods) {
+        mods_changed = true;
     }
 
     new_mods.weak_mods = get_weak_mods();
-    if (!mods_need_sync && new_mods.weak_mods != split_shmem->mods.weak_mods) {
-        mods_need_sync = true;
+    if (new_mods.weak_mods != split_shmem->mods.weak_mods) {
+        mods_changed = true;
     }
 
 #    ifndef NO_ACTION_ONESHOT
     new_mods.oneshot_mods = get_oneshot_mods();
-    if (!mods_need_sync && new_mods.oneshot_mods != split_shmem->mods.oneshot_mods) {
-        mods_need_sync = true;
+    if (new_mods.oneshot_mods != split_shmem->mods.oneshot_mods) {
+        mods_changed = true;
     }
 #    endif // NO_ACTION_ONESHOT
 
     bool okay = true;
-    if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+    if (sync_is_due(&schedule, mods_changed)) {
+        okay &= handler_write(PUT_MODS, &new_mods, sizeof(new_mods));
         if (okay) {
-            last_update = timer_read32();
+            sync_done(&schedule, mods_changed);
         }
     }
 
@@ -378,9 +829,9 @@ static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #ifdef BACKLIGHT_ENABLE
 
 static bool backlight_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         level       = is_backlight_enabled() ? get_backlight_level() : 0;
-    return send_if_condition(PUT_BACKLIGHT, &last_update, (level != split_shmem->backlight_level), &level, sizeof(level));
+    static sync_schedule_t schedule = SYNC_SCHEDULE(SYNC_ON_CHANGE);
+    uint8_t                level    = is_backlight_enabled() ? get_backlight_level() : 0;
+    return send_if_condition(PUT_BACKLIGHT, &schedule, (level != split_shmem->backlight_level), &level, sizeof(level));
 }
 
 static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -405,15 +856,21 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
 static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update = 0;
-    rgblight_syncinfo_t rgblight_sync;
+    static sync_schedule_t schedule = SYNC_SCHEDULE(SYNC_OPPORTUNISTIC);
+    rgblight_syncinfo_t    rgblight_sync;
     rgblight_get_syncinfo(&rgblight_sync);
-    if (send_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
-        rgblight_clear_change_flags();
-    } else {
-        return false;
+    bool changed = rgblight_sync.status.change_flags != 0;
+
+    bool okay = true;
+    if (sync_is_due(&schedule, changed)) {
+        okay &= handler_write(PUT_RGBLIGHT, &rgblight_sync, sizeof(rgblight_sync));
+        if (okay) {
+            sync_done(&schedule, changed);
+            // Only once they've gone out, a deferred send still needs the flags on the next scan
+            rgblight_clear_change_flags();
+        }
     }
-    return true;
+    return okay;
 }
 
 static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -442,11 +899,11 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
 static bool led_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t   last_update = 0;
-    led_matrix_sync_t led_matrix_sync;
+    static sync_schedule_t schedule = SYNC_SCHEDULE(SYNC_OPPORTUNISTIC);
+    led_matrix_sync_t      led_matrix_sync;
     memcpy(&led_matrix_sync.led_matrix, &led_matrix_eeconfig, sizeof(led_eeconfig_t));
     led_matrix_sync.led_suspend_state = led_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_LED_MATRIX, &last_update, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
+    return send_if_data_mismatch(PUT_LED_MATRIX, &schedule, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
 }
 
 static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -472,11 +929,11 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
 static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t   last_update = 0;
-    rgb_matrix_sync_t rgb_matrix_sync;
+    static sync_schedule_t schedule = SYNC_SCHEDULE(SYNC_OPPORTUNISTIC);
+    rgb_matrix_sync_t      rgb_matrix_sync;
     memcpy(&rgb_matrix_sync.rgb_matrix, &rgb_matrix_config, sizeof(rgb_config_t));
     rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+    return send_if_data_mismatch(PUT_RGB_MATRIX, &schedule, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
 }
 
 static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -502,9 +959,9 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
 
 static bool wpm_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         current_wpm = get_current_wpm();
-    return send_if_condition(PUT_WPM, &last_update, (current_wpm != split_shmem->current_wpm), &current_wpm, sizeof(current_wpm));
+    static sync_schedule_t schedule    = SYNC_SCHEDULE(SYNC_OPPORTUNISTIC);
+    uint8_t                current_wpm = get_current_wpm();
+    return send_if_condition(PUT_WPM, &schedule, (current_wpm != split_shmem->current_wpm), &current_wpm, sizeof(current_wpm));
 }
 
 static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -529,9 +986,9 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
 static bool oled_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update        = 0;
-    bool            current_oled_state = is_oled_on();
-    return send_if_condition(PUT_OLED, &last_update, (current_oled_state != split_shmem->current_oled_state), &current_oled_state, sizeof(current_oled_state));
+    static sync_schedule_t schedule           = SYNC_SCHEDULE(SYNC_ON_CHANGE);
+    bool                   current_oled_state = is_oled_on();
+    return send_if_condition(PUT_OLED, &schedule, (current_oled_state != split_shmem->current_oled_state), &current_oled_state, sizeof(current_oled_state));
 }
 
 static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -560,9 +1017,9 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
 static bool st7565_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update          = 0;
-    bool            current_st7565_state = st7565_is_on();
-    return send_if_condition(PUT_ST7565, &last_update, (current_st7565_state != split_shmem->current_st7565_state), &current_st7565_state, sizeof(current_st7565_state));
+    static sync_schedule_t schedule             = SYNC_SCHEDULE(SYNC_ON_CHANGE);
+    bool                   current_st7565_state = st7565_is_on();
+    return send_if_condition(PUT_ST7565, &schedule, (current_st7565_state != split_shmem->current_st7565_state), &current_st7565_state, sizeof(current_st7565_state));
 }
 
 static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -600,16 +1057,31 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
         return true;
     }
 #    endif
-    static uint32_t last_update = 0;
-    static uint16_t last_cpi    = 0;
-    report_mouse_t  temp_state;
-    uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
-    if (okay) pointing_device_set_shared_report(temp_state);
+    static sync_schedule_t         schedule = SYNC_SCHEDULE(SYNC_REALTIME);
+    static split_pointing_motion_t received = {0};
+    static bool                    synced   = false;
+    static uint16_t                last_cpi = 0;
+    split_pointing_motion_t        temp_state;
+    uint16_t                       temp_cpi;
+    if (!is_transport_connected()) {
+        // The slave may have restarted, don't mistake its new totals for motion
+        synced = false;
+    }
+    bool okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &schedule, &temp_state, &split_shmem->pointing.motion, sizeof(temp_state));
+    if (okay) {
+        if (synced) {
+            // Differences of the totals, so missed or repeated reads neither lose nor duplicate motion
+            pointing_device_add_shared_motion((int16_t)(temp_state.x - received.x), (int16_t)(temp_state.y - received.y), (int16_t)(temp_state.h - received.h), (int16_t)(temp_state.v - received.v), temp_state.buttons);
+        } else {
+            pointing_device_add_shared_motion(0, 0, 0, 0, temp_state.buttons);
+        }
+        received = temp_state;
+        synced   = true;
+    }
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi && memcmp(&last_cpi, &temp_cpi, sizeof(temp_cpi)) != 0) {
         memcpy(&split_shmem->pointing.cpi, &temp_cpi, sizeof(temp_cpi));
-        okay = transport_write(PUT_POINTING_CPI, &split_shmem->pointing.cpi, sizeof(split_shmem->pointing.cpi));
+        okay = handler_write(PUT_POINTING_CPI, &split_shmem->pointing.cpi, sizeof(split_shmem->pointing.cpi));
         if (okay) {
             last_cpi = temp_cpi;
         }
@@ -638,22 +1110,36 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     }
     last_exec = timer_read32();
 #    endif
+    pointing_device_pipeline_lock();
     temp_cpi = !pointing_device_driver.get_cpi ? 0 : pointing_device_driver.get_cpi(); // check for NULL
     if (split_shmem->pointing.cpi && memcmp(&split_shmem->pointing.cpi, &temp_cpi, sizeof(temp_cpi)) != 0) {
         if (pointing_device_driver.set_cpi) {
             pointing_device_driver.set_cpi(split_shmem->pointing.cpi);
         }
     }
+    pointing_device_pipeline_unlock();
     memset(&temp_report, 0, sizeof(temp_report));
+#    ifdef POINTING_DEVICE_SAMPLE_INTERVAL_US
+    temp_report = pointing_device_pipeline_get_report(temp_report);
+#    else
     temp_report = pointing_device_driver.get_report(temp_report);
-    memcpy(&split_shmem->pointing.report, &temp_report, sizeof(temp_report));
-    // Now update the checksum given that the pointing has been written to
-    split_shmem->pointing.checksum = crc8(&temp_report, sizeof(temp_report));
+#    endif
+    split_pointing_motion_t *motion = &split_shmem->pointing.motion;
+    if (temp_report.x || temp_report.y || temp_report.h || temp_report.v || temp_report.buttons != motion->buttons) {
+        motion->x += (uint16_t)temp_report.x;
+        motion->y += (uint16_t)temp_report.y;
+        motion->h += (uint16_t)temp_report.h;
+        motion->v += (uint16_t)temp_report.v;
+        motion->buttons = temp_report.buttons;
+        motion->sequence++;
+        // Now update the checksum given that the pointing has been written to
+        split_shmem->pointing.checksum = crc8(motion, sizeof(*motion));
+    }
 }
 
 #    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
 #    define TRANSACTIONS_POINTING_SLAVE() TRANSACTION_HANDLER_SLAVE(pointing)
-#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.motion), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
 
 #else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -674,6 +1160,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // USE_I2C
 
     // clang-format off
+    TRANSACTIONS_BATCH_REGISTRATIONS
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
@@ -700,9 +1187,32 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    sync_scan_start();
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+    // The batch is the only round trip: everything sent to the target is staged ahead of it so it goes out this
+    // scan, and everything read from the target is served from its response afterwards
+    TRANSACTIONS_MASTER_MATRIX_MASTER();
+    TRANSACTIONS_SYNC_TIMER_MASTER();
+    TRANSACTIONS_LAYER_STATE_MASTER();
+    TRANSACTIONS_LED_STATE_MASTER();
+    TRANSACTIONS_MODS_MASTER();
+    TRANSACTIONS_BACKLIGHT_MASTER();
+    TRANSACTIONS_RGBLIGHT_MASTER();
+    TRANSACTIONS_LED_MATRIX_MASTER();
+    TRANSACTIONS_RGB_MATRIX_MASTER();
+    TRANSACTIONS_WPM_MASTER();
+    TRANSACTIONS_OLED_MASTER();
+    TRANSACTIONS_ST7565_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
+    TRANSACTIONS_SLAVE_MATRIX_MASTER();
+    TRANSACTIONS_ENCODERS_MASTER();
+    TRANSACTIONS_POINTING_MASTER();
+#else
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
+    // Motion goes ahead of the lighting and display syncs, which yield when the bus is busy
+    TRANSACTIONS_POINTING_MASTER();
     TRANSACTIONS_SYNC_TIMER_MASTER();
     TRANSACTIONS_LAYER_STATE_MASTER();
     TRANSACTIONS_LED_STATE_MASTER();
@@ -714,7 +1224,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_WPM_MASTER();
     TRANSACTIONS_OLED_MASTER();
     TRANSACTIONS_ST7565_MASTER();
-    TRANSACTIONS_POINTING_MASTER();
+#endif // SPLIT_TRANSACTIONS_BATCHED
     return true;
 }
 
@@ -722,6 +1232,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
     TRANSACTIONS_ENCODERS_SLAVE();
+    TRANSACTIONS_POINTING_SLAVE();
     TRANSACTIONS_SYNC_TIMER_SLAVE();
     TRANSACTIONS_LAYER_STATE_SLAVE();
     TRANSACTIONS_LED_STATE_SLAVE();
@@ -733,7 +1244,6 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_WPM_SLAVE();
     TRANSACTIONS_OLED_SLAVE();
     TRANSACTIONS_ST7565_SLAVE();
-    TRANSACTIONS_POINTING_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -31,6 +31,14 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_BATCH_M2S_BUFFER_SIZE
+#    define SPLIT_BATCH_M2S_BUFFER_SIZE 24
+#endif // SPLIT_BATCH_M2S_BUFFER_SIZE
+
+#ifndef SPLIT_BATCH_S2M_BUFFER_SIZE
+#    define SPLIT_BATCH_S2M_BUFFER_SIZE 32
+#endif // SPLIT_BATCH_S2M_BUFFER_SIZE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -52,11 +60,68 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #    include "rgblight.h"
 #endif // RGBLIGHT_ENABLE
 
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+typedef struct _split_batch_m2s_t {
+    uint8_t checksum; // covers seq and buffer
+    uint8_t seq;
+    uint8_t buffer[SPLIT_BATCH_M2S_BUFFER_SIZE];
+} split_batch_m2s_t;
+
+typedef struct _split_batch_s2m_t {
+    uint8_t checksum; // covers ack and buffer
+    uint8_t ack;      // seq of the last intact initiator->target frame
+    uint8_t buffer[SPLIT_BATCH_S2M_BUFFER_SIZE];
+} split_batch_s2m_t;
+
+typedef struct _split_batch_sync_t {
+    split_batch_m2s_t m2s;
+    split_batch_s2m_t s2m;
+} split_batch_sync_t;
+#endif // SPLIT_TRANSACTIONS_BATCHED
+
 typedef struct _split_slave_matrix_sync_t {
     uint8_t      checksum;
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_MATRIX_EVENTS
+#    ifndef SPLIT_MATRIX_EVENTS_WINDOW
+#        define SPLIT_MATRIX_EVENTS_WINDOW 4
+#    endif // SPLIT_MATRIX_EVENTS_WINDOW
+
+#    ifndef SPLIT_MATRIX_EVENTS_QUEUE_SIZE
+#        define SPLIT_MATRIX_EVENTS_QUEUE_SIZE 16
+#    endif // SPLIT_MATRIX_EVENTS_QUEUE_SIZE
+
+typedef struct _split_slave_event_t {
+    uint16_t time;
+    uint8_t  row;
+    uint8_t  col : 7;
+    uint8_t  pressed : 1;
+} split_slave_event_t;
+
+typedef struct _split_slave_events_snapshot_t {
+    uint8_t checksum;
+    struct {
+        uint8_t      epoch;
+        uint8_t      end_seq; // sequence number of the next change, the matrix includes every earlier one
+        matrix_row_t matrix[(MATRIX_ROWS) / 2];
+    } payload;
+} split_slave_events_snapshot_t;
+
+typedef struct _split_slave_events_sync_t {
+    uint8_t checksum;
+    struct {
+        uint8_t             epoch;
+        uint8_t             first_seq;
+        uint8_t             count;
+        split_slave_event_t events[SPLIT_MATRIX_EVENTS_WINDOW];
+    } payload;
+    uint8_t                       ack;
+    split_slave_events_snapshot_t snapshot;
+} split_slave_events_sync_t;
+#endif // SPLIT_MATRIX_EVENTS
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -107,10 +172,20 @@ typedef struct _split_mods_sync_t {
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
+// Running totals of the slave's motion, the master applies the difference to the last totals it received
+typedef struct _split_pointing_motion_t {
+    uint8_t  sequence; // bumped with every update, so repeated identical motion still changes the checksum
+    uint8_t  buttons;
+    uint16_t x;
+    uint16_t y;
+    uint16_t h;
+    uint16_t v;
+} split_pointing_motion_t;
+
 typedef struct _split_slave_pointing_sync_t {
-    uint8_t        checksum;
-    report_mouse_t report;
-    uint16_t       cpi;
+    uint8_t                 checksum;
+    split_pointing_motion_t motion;
+    uint16_t                cpi;
 } split_slave_pointing_sync_t;
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -130,7 +205,15 @@ typedef struct _split_shared_memory_t {
     int8_t transaction_id;
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSACTIONS_BATCHED
+    split_batch_sync_t batch;
+#endif // SPLIT_TRANSACTIONS_BATCHED
+
+#ifdef SPLIT_MATRIX_EVENTS
+    split_slave_events_sync_t sevents;
+#else
     split_slave_matrix_sync_t smatrix;
+#endif // SPLIT_MATRIX_EVENTS
 
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
@@ -0,0 +1,24 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 1
+#define MATRIX_COLS 1
+
+// clang-format off
+#define PROCESS_RECORD_PIPELINE \
+    PROCESS_RECORD_OBSERVE_ALL(mock_handler_0) \
+    PROCESS_RECORD_KEYCODES(mock_handler_1, mock_handler_1_keycodes) \
+    PROCESS_RECORD_KEYCODES(mock_handler_2, mock_handler_2_keycodes) \
+    PROCESS_RECORD_KEYCODES(mock_handler_3, mock_handler_3_keycodes)
+// clang-format on
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "tests/process_record_dispatch_mock.h"
+
+#ifdef __cplusplus
+};
+#endif
@@ -0,0 +1,54 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "tests/process_record_dispatch_mock.h"
+
+const process_record_range_t mock_handler_1_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(0x10, 0x1F),
+    PROCESS_RECORD_RANGES_END,
+};
+
+const process_record_range_t mock_handler_2_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(0x18, 0x27),
+    PROCESS_RECORD_KEYCODE(0x40),
+    PROCESS_RECORD_RANGES_END,
+};
+
+const process_record_range_t mock_handler_3_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(0x10, 0x1F),
+    PROCESS_RECORD_RANGES_END,
+};
+
+bool    mock_handler_result[MOCK_HANDLER_COUNT];
+uint8_t mock_calls[MOCK_CALLS_MAX];
+uint8_t mock_calls_count;
+
+static bool mock_handler(uint8_t index) {
+    if (mock_calls_count < MOCK_CALLS_MAX) {
+        mock_calls[mock_calls_count++] = index;
+    }
+    return mock_handler_result[index];
+}
+
+bool mock_handler_0(uint16_t keycode, keyrecord_t *record) {
+    return mock_handler(0);
+}
+
+bool mock_handler_1(uint16_t keycode, keyrecord_t *record) {
+    return mock_handler(1);
+}
+
+bool mock_handler_2(uint16_t keycode, keyrecord_t *record) {
+    return mock_handler(2);
+}
+
+bool mock_handler_3(uint16_t keycode, keyrecord_t *record) {
+    return mock_handler(3);
+}
+
+void mock_handlers_reset(void) {
+    for (uint8_t i = 0; i < MOCK_HANDLER_COUNT; i++) {
+        mock_handler_result[i] = true;
+    }
+    mock_calls_count = 0;
+}
@@ -0,0 +1,26 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "process_record_dispatch.h"
+
+#define MOCK_HANDLER_COUNT 4
+#define MOCK_CALLS_MAX 16
+
+extern const process_record_range_t mock_handler_1_keycodes[];
+extern const process_record_range_t mock_handler_2_keycodes[];
+extern const process_record_range_t mock_handler_3_keycodes[];
+
+bool mock_handler_0(uint16_t keycode, keyrecord_t *record);
+bool mock_handler_1(uint16_t keycode, keyrecord_t *record);
+bool mock_handler_2(uint16_t keycode, keyrecord_t *record);
+bool mock_handler_3(uint16_t keycode, keyrecord_t *record);
+
+/* Value returned by each handler */
+extern bool mock_handler_result[MOCK_HANDLER_COUNT];
+
+/* Handlers called since the last reset, in order */
+extern uint8_t mock_calls[MOCK_CALLS_MAX];
+extern uint8_t mock_calls_count;
+
+void mock_handlers_reset(void);
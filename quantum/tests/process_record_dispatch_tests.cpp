@@ -0,0 +1,106 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <vector>
+
+extern "C" {
+#include "process_record_dispatch.h"
+}
+
+using testing::Contains;
+
+/*
+ * The mock pipeline, from process_record_dispatch_config.h:
+ *   0: every keycode
+ *   1: 0x10-0x1F
+ *   2: 0x18-0x27 and 0x40
+ *   3: 0x10-0x1F
+ */
+class ProcessRecordDispatch : public testing::Test {
+   protected:
+    void SetUp() override {
+        mock_handlers_reset();
+#ifdef PROCESS_RECORD_DISPATCH_SIZE
+        process_record_dispatch_init();
+#endif
+    }
+
+    /* Returns the handlers called for the keycode, in order */
+    std::vector<uint8_t> dispatch(uint16_t keycode, bool expected_result = true) {
+        keyrecord_t record = {};
+        mock_calls_count   = 0;
+        EXPECT_EQ(process_record_dispatch(keycode, &record), expected_result);
+        return std::vector<uint8_t>(mock_calls, mock_calls + mock_calls_count);
+    }
+};
+
+TEST_F(ProcessRecordDispatch, HandlersCalledInPipelineOrder) {
+    std::vector<uint8_t> calls = dispatch(0x1A);
+    EXPECT_EQ(calls, (std::vector<uint8_t>{0, 1, 2, 3}));
+}
+
+TEST_F(ProcessRecordDispatch, HandlerStopsProcessing) {
+    mock_handler_result[1] = false;
+    EXPECT_EQ(dispatch(0x1A, false), (std::vector<uint8_t>{0, 1}));
+}
+
+TEST_F(ProcessRecordDispatch, ObserverStopsProcessing) {
+    mock_handler_result[0] = false;
+    EXPECT_EQ(dispatch(0x1A, false), (std::vector<uint8_t>{0}));
+}
+
+TEST_F(ProcessRecordDispatch, HandlersOfferedTheirKeycodes) {
+    for (uint16_t keycode : {0x10, 0x17, 0x18, 0x1F, 0x20, 0x27, 0x40}) {
+        std::vector<uint8_t> calls = dispatch(keycode);
+        if (keycode >= 0x10 && keycode <= 0x1F) {
+            EXPECT_THAT(calls, Contains(1)) << "keycode " << keycode;
+            EXPECT_THAT(calls, Contains(3)) << "keycode " << keycode;
+        }
+        if ((keycode >= 0x18 && keycode <= 0x27) || keycode == 0x40) {
+            EXPECT_THAT(calls, Contains(2)) << "keycode " << keycode;
+        }
+    }
+}
+
+#if !defined(PROCESS_RECORD_DISPATCH_SIZE)
+
+TEST_F(ProcessRecordDispatch, UnindexedOffersEveryKeycode) {
+    EXPECT_EQ(dispatch(0x05), (std::vector<uint8_t>{0, 1, 2, 3}));
+    EXPECT_EQ(dispatch(0xFFFF), (std::vector<uint8_t>{0, 1, 2, 3}));
+}
+
+#elif PROCESS_RECORD_DISPATCH_SIZE >= 6
+
+TEST_F(ProcessRecordDispatch, SkipsHandlersOutsideTheirRanges) {
+    EXPECT_EQ(dispatch(0x00), (std::vector<uint8_t>{0}));
+    EXPECT_EQ(dispatch(0x0F), (std::vector<uint8_t>{0}));
+    EXPECT_EQ(dispatch(0x10), (std::vector<uint8_t>{0, 1, 3}));
+    EXPECT_EQ(dispatch(0x17), (std::vector<uint8_t>{0, 1, 3}));
+    EXPECT_EQ(dispatch(0x1F), (std::vector<uint8_t>{0, 1, 2, 3}));
+    EXPECT_EQ(dispatch(0x20), (std::vector<uint8_t>{0, 2}));
+    EXPECT_EQ(dispatch(0x28), (std::vector<uint8_t>{0}));
+    EXPECT_EQ(dispatch(0x40), (std::vector<uint8_t>{0, 2}));
+    EXPECT_EQ(dispatch(0x41), (std::vector<uint8_t>{0}));
+    EXPECT_EQ(dispatch(0xFFFF), (std::vector<uint8_t>{0}));
+}
+
+TEST_F(ProcessRecordDispatch, InitIsRepeatable) {
+    process_record_dispatch_init();
+    EXPECT_EQ(dispatch(0x20), (std::vector<uint8_t>{0, 2}));
+    EXPECT_EQ(dispatch(0x41), (std::vector<uint8_t>{0}));
+}
+
+#else
+
+// Handler 2 needs the fourth and later segments, so falls back to observing every keycode
+TEST_F(ProcessRecordDispatch, OverflowedHandlerObservesAll) {
+    EXPECT_EQ(dispatch(0x00), (std::vector<uint8_t>{0, 2}));
+    EXPECT_EQ(dispatch(0x10), (std::vector<uint8_t>{0, 1, 2, 3}));
+    EXPECT_EQ(dispatch(0x20), (std::vector<uint8_t>{0, 2}));
+    EXPECT_EQ(dispatch(0x40), (std::vector<uint8_t>{0, 2}));
+    EXPECT_EQ(dispatch(0xFFFF), (std::vector<uint8_t>{0, 2}));
+}
+
+#endif
@@ -0,0 +1,28 @@
+process_record_dispatch_common_DEFS := \
+	-DNO_PRINT \
+	-DNO_DEBUG
+process_record_dispatch_common_CONFIG := $(QUANTUM_PATH)/tests/process_record_dispatch_config.h
+process_record_dispatch_common_SRC := \
+	$(QUANTUM_PATH)/process_record_dispatch.c \
+	$(QUANTUM_PATH)/tests/process_record_dispatch_mock.c \
+	$(QUANTUM_PATH)/tests/process_record_dispatch_tests.cpp
+
+process_record_dispatch_DEFS := \
+	$(process_record_dispatch_common_DEFS) \
+	-DPROCESS_RECORD_DISPATCH_SIZE=16
+process_record_dispatch_CONFIG := $(process_record_dispatch_common_CONFIG)
+process_record_dispatch_SRC := \
+	$(process_record_dispatch_common_SRC)
+
+process_record_dispatch_overflow_DEFS := \
+	$(process_record_dispatch_common_DEFS) \
+	-DPROCESS_RECORD_DISPATCH_SIZE=3
+process_record_dispatch_overflow_CONFIG := $(process_record_dispatch_common_CONFIG)
+process_record_dispatch_overflow_SRC := \
+	$(process_record_dispatch_common_SRC)
+
+process_record_dispatch_unindexed_DEFS := \
+	$(process_record_dispatch_common_DEFS)
+process_record_dispatch_unindexed_CONFIG := $(process_record_dispatch_common_CONFIG)
+process_record_dispatch_unindexed_SRC := \
+	$(process_record_dispatch_common_SRC)
@@ -0,0 +1,4 @@
+TEST_LIST += \
+	process_record_dispatch \
+	process_record_dispatch_overflow \
+	process_record_dispatch_unindexed
@@ -156,6 +156,11 @@ void via_set_layout_options(uint32_t value) {
     }
 }
 
+const process_record_range_t process_record_via_keycodes[] PROGMEM = {
+    PROCESS_RECORD_RANGE(FN_MO13, MACRO15),
+    PROCESS_RECORD_RANGES_END,
+};
+
 // Called by QMK core to process VIA-specific keycodes.
 bool process_record_via(uint16_t keycode, keyrecord_t *record) {
     // Handle macros
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "eeconfig.h" // for EECONFIG_SIZE
+#include "process_record_dispatch.h"
 
 // Keyboard level code can change where VIA stores the magic.
 // The magic is the build date YYMMDD encoded as BCD in 3 bytes,
@@ -167,3 +168,4 @@ void     via_set_layout_options_kb(uint32_t value);
 
 // Called by QMK core to process VIA-specific keycodes.
 bool process_record_via(uint16_t keycode, keyrecord_t *record);
+extern const process_record_range_t process_record_via_keycodes[];
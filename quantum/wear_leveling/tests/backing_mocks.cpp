@@ -14,15 +14,17 @@ void MockBackingStore::reset_instance() {
 
     locked = true;
 
-    backing_erasure_count     = 0;
-    backing_max_write_count   = 0;
-    backing_total_write_count = 0;
-
-    backing_init_invoke_count   = 0;
-    backing_unlock_invoke_count = 0;
-    backing_erase_invoke_count  = 0;
-    backing_write_invoke_count  = 0;
-    backing_lock_invoke_count   = 0;
+    backing_erasure_count      = 0;
+    backing_max_write_count    = 0;
+    backing_total_write_count  = 0;
+    backing_total_erased_bytes = 0;
+
+    backing_init_invoke_count        = 0;
+    backing_unlock_invoke_count      = 0;
+    backing_erase_invoke_count       = 0;
+    backing_erase_range_invoke_count = 0;
+    backing_write_invoke_count       = 0;
+    backing_lock_invoke_count        = 0;
 
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
@@ -72,6 +74,28 @@ bool MockBackingStore::erase(void) {
     append_log(true);
 
     ++backing_erasure_count;
+    backing_total_erased_bytes += WEAR_LEVELING_BACKING_SIZE;
+    return true;
+}
+
+bool MockBackingStore::erase_range(uint32_t address, size_t length) {
+    ++backing_erase_range_invoke_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + length <= WEAR_LEVELING_BACKING_SIZE) << "Range would result of out-of-bounds access";
+    EXPECT_FALSE(is_locked()) << "Erase was attempted without being unlocked first";
+
+    // Drop out of erase early with failure if we need to
+    if (erase_success_callback && !erase_success_callback(backing_erase_invoke_count + backing_erase_range_invoke_count)) {
+        return false;
+    }
+
+    // Erase each slot within the range
+    for (std::size_t i = address / BACKING_STORE_WRITE_SIZE; i < (address + length) / BACKING_STORE_WRITE_SIZE; ++i) {
+        backing_storage[i].erase();
+    }
+
+    backing_total_erased_bytes += length;
     return true;
 }
 
@@ -141,6 +165,10 @@ extern "C" bool backing_store_erase(void) {
     return MockBackingStore::Instance().erase();
 }
 
+extern "C" bool backing_store_erase_range(uint32_t address, size_t length) {
+    return MockBackingStore::Instance().erase_range(address, length);
+}
+
 extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return MockBackingStore::Instance().write(address, value);
 }
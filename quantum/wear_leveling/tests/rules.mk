@@ -63,4 +63,75 @@ wear_leveling_8byte_SRC := \
 	$(wear_leveling_common_SRC) \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
-	$(wear_leveling_common_INC)
\ No newline at end of file
+	$(wear_leveling_common_INC)
+
+wear_leveling_dual_bank_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=128 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=16 \
+	-DWEAR_LEVELING_DUAL_BANK \
+	-DWEAR_LEVELING_CONSOLIDATION_STEP_SIZE=4 \
+	-DBACKING_STORE_ERASE_SIZE=32
+wear_leveling_dual_bank_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_dual_bank.cpp
+wear_leveling_dual_bank_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_write_combining_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=2048 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=256 \
+	-DWEAR_LEVELING_WRITE_COMBINING
+wear_leveling_write_combining_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(PLATFORM_PATH)/test/timer.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_write_combining.cpp \
+	tests/test_common/test_metrics.cpp
+wear_leveling_write_combining_INC := \
+	$(wear_leveling_common_INC) \
+	$(PLATFORM_PATH) \
+	tests/test_common
+
+wear_leveling_simulator_common_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(PLATFORM_PATH)/test/timer.c \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_simulator.cpp \
+	tests/test_common/test_metrics.cpp
+wear_leveling_simulator_common_INC := \
+	$(wear_leveling_common_INC) \
+	$(PLATFORM_PATH) \
+	$(QUANTUM_PATH) \
+	tests/test_common
+
+wear_leveling_simulator_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=2048 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024
+wear_leveling_simulator_SRC := \
+	$(wear_leveling_simulator_common_SRC)
+wear_leveling_simulator_INC := \
+	$(wear_leveling_simulator_common_INC)
+
+wear_leveling_simulator_write_combining_DEFS := \
+	$(wear_leveling_simulator_DEFS) \
+	-DWEAR_LEVELING_WRITE_COMBINING
+wear_leveling_simulator_write_combining_SRC := \
+	$(wear_leveling_simulator_common_SRC)
+wear_leveling_simulator_write_combining_INC := \
+	$(wear_leveling_simulator_common_INC)
+
+wear_leveling_simulator_dual_bank_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=4096 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=1024 \
+	-DWEAR_LEVELING_DUAL_BANK \
+	-DBACKING_STORE_ERASE_SIZE=512
+wear_leveling_simulator_dual_bank_SRC := \
+	$(wear_leveling_simulator_common_SRC)
+wear_leveling_simulator_dual_bank_INC := \
+	$(wear_leveling_simulator_common_INC)
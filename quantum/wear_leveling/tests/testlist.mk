@@ -3,4 +3,9 @@ TEST_LIST += \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_dual_bank \
+	wear_leveling_write_combining \
+	wear_leveling_simulator \
+	wear_leveling_simulator_write_combining \
+	wear_leveling_simulator_dual_bank
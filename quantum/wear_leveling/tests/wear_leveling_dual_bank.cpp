@@ -0,0 +1,295 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+using logical_t = std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>;
+
+// Number of task invocations spent erasing the idle bank
+constexpr int erase_steps = (WEAR_LEVELING_BANK_SIZE) / (WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE);
+
+class WearLevelingDualBank : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+
+    logical_t read_all() {
+        logical_t values;
+        EXPECT_EQ(wear_leveling_read(0, values.data(), values.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        return values;
+    }
+
+    // Changes single bytes until a background consolidation would be started by the next task invocation
+    void fill_to_threshold(logical_t& expected) {
+        for (std::size_t i = 0; i < (WEAR_LEVELING_CONSOLIDATION_THRESHOLD) / (BACKING_STORE_WRITE_SIZE); ++i) {
+            expected[i % expected.size()] += (std::uint8_t)(0x40 + i);
+            EXPECT_EQ(wear_leveling_write(i % expected.size(), &expected[i % expected.size()], 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        }
+    }
+
+    // Runs the background task until it reports consolidation, returning the number of invocations required
+    int run_until_consolidated() {
+        for (int i = 1; i < 1000; ++i) {
+            wear_leveling_status_t status = wear_leveling_task();
+            EXPECT_NE(status, WEAR_LEVELING_FAILED) << "Task failed";
+            if (status != WEAR_LEVELING_SUCCESS) {
+                return i;
+            }
+        }
+        ADD_FAILURE() << "Consolidation never completed";
+        return -1;
+    }
+
+    // Returns whether the bank at the supplied address has its commit marker set
+    bool bank_committed(std::uint32_t bank_address) {
+        write_log_entry_t entry;
+        for (std::size_t i = 0; i < sizeof(entry) / sizeof(backing_store_int_t); ++i) {
+            backing_store_read(bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8 + i * sizeof(backing_store_int_t), &((backing_store_int_t*)&entry)[i]);
+        }
+        return entry.raw8[7] != 0;
+    }
+};
+
+/**
+ * This test verifies that the task does nothing until the write log has reached the consolidation threshold.
+ */
+TEST_F(WearLevelingDualBank, TaskIdleBelowThreshold) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t value = 0x12;
+    EXPECT_EQ(wear_leveling_write(0x01, &value, 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    uint64_t write_count = inst.write_invoke_count();
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    }
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Task should not have written";
+    EXPECT_EQ(inst.erase_range_invoke_count(), 0) << "Task should not have erased";
+}
+
+/**
+ * This test verifies that consolidation is split into a number of bounded erase steps, a number of bounded copy steps,
+ * and a commit.
+ */
+TEST_F(WearLevelingDualBank, ConsolidationIsIncremental) {
+    auto&     inst     = MockBackingStore::Instance();
+    logical_t expected = {};
+    fill_to_threshold(expected);
+
+    // First steps erase the idle bank, one part at a time
+    uint64_t write_count = inst.write_invoke_count();
+    for (int i = 0; i < erase_steps; ++i) {
+        uint64_t erased_bytes = inst.total_erased_bytes();
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+        EXPECT_EQ(inst.erase_range_invoke_count(), i + 1) << "Erase step should have erased once";
+        EXPECT_EQ(inst.total_erased_bytes() - erased_bytes, WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE) << "Erase step erased an unexpected amount";
+    }
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Erase steps should not have written";
+
+    // Each copy step writes no more than the configured amount
+    for (std::size_t i = 0; i < (WEAR_LEVELING_LOGICAL_SIZE) / (WEAR_LEVELING_CONSOLIDATION_STEP_SIZE); ++i) {
+        write_count = inst.write_invoke_count();
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+        EXPECT_EQ(inst.write_invoke_count() - write_count, (WEAR_LEVELING_CONSOLIDATION_STEP_SIZE) / (BACKING_STORE_WRITE_SIZE)) << "Copy step wrote an unexpected amount";
+    }
+    EXPECT_FALSE(bank_committed(WEAR_LEVELING_BANK_SIZE)) << "Bank should not be committed before the copy completes";
+
+    // Final step commits the bank
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_CONSOLIDATED) << "Task should have completed consolidation";
+    EXPECT_TRUE(bank_committed(WEAR_LEVELING_BANK_SIZE)) << "Bank should be committed";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Full erase should never be used";
+
+    EXPECT_EQ(read_all(), expected) << "Invalid readback";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(read_all(), expected) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that writes never erase when the task is able to keep up, and that the banks alternate.
+ */
+TEST_F(WearLevelingDualBank, WritesNeverErase) {
+    auto&     inst           = MockBackingStore::Instance();
+    logical_t expected       = {};
+    int       consolidations = 0;
+
+    for (int i = 0; i < 500; ++i) {
+        uint64_t erase_count       = inst.erase_range_invoke_count();
+        expected[i % 3 + 4]        = (std::uint8_t)i;
+        wear_leveling_status_t ret = wear_leveling_write(i % 3 + 4, &expected[i % 3 + 4], 1);
+        EXPECT_EQ(ret, WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        EXPECT_EQ(inst.erase_range_invoke_count(), erase_count) << "Write should not have erased";
+
+        if (wear_leveling_task() == WEAR_LEVELING_CONSOLIDATED) {
+            ++consolidations;
+            EXPECT_TRUE(bank_committed(consolidations % 2 ? WEAR_LEVELING_BANK_SIZE : 0)) << "Bank should have been committed";
+        }
+    }
+
+    EXPECT_GT(consolidations, 10) << "Banks should have alternated";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(read_all(), expected) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that writes made while consolidation is in progress end up in the new bank, both for areas that
+ * have already been copied and areas that have not.
+ */
+TEST_F(WearLevelingDualBank, WritesDuringConsolidationSurvive) {
+    logical_t expected = {};
+    fill_to_threshold(expected);
+
+    // Erase, then copy the first step
+    for (int i = 0; i < erase_steps + 1; ++i) {
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    }
+
+    // One write behind the copy, one ahead of it
+    expected[0]                   = 0xA0;
+    expected[expected.size() - 3] = 0xA1;
+    expected[expected.size() - 2] = 0xA2;
+    EXPECT_EQ(wear_leveling_write(0, &expected[0], 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_write(expected.size() - 3, &expected[expected.size() - 3], 2), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    run_until_consolidated();
+
+    // Both writes were logged into the new bank, and land after a further write too
+    expected[1] = 0xA3;
+    EXPECT_EQ(wear_leveling_write(1, &expected[1], 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(read_all(), expected) << "Invalid readback";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(read_all(), expected) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that losing power at any point during consolidation leaves the previous bank in use, with no data
+ * lost.
+ */
+TEST_F(WearLevelingDualBank, PowerLossDuringConsolidation_KeepsActiveBank) {
+    const int steps = erase_steps + (WEAR_LEVELING_LOGICAL_SIZE) / (WEAR_LEVELING_CONSOLIDATION_STEP_SIZE) + 1;
+    for (int interrupted_after = 0; interrupted_after < steps; ++interrupted_after) {
+        MockBackingStore::Instance().reset_instance();
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+
+        logical_t expected = {};
+        fill_to_threshold(expected);
+        for (int i = 0; i < interrupted_after; ++i) {
+            EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+        }
+        expected[0] = 0xB0;
+        EXPECT_EQ(wear_leveling_write(0, &expected[0], 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+        // "Power loss" -- re-init without completing the consolidation
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        EXPECT_EQ(read_all(), expected) << "Invalid readback after interruption at step " << interrupted_after;
+        EXPECT_FALSE(bank_committed(WEAR_LEVELING_BANK_SIZE)) << "Interrupted bank should not be committed";
+
+        // The abandoned consolidation starts over, and completes normally
+        run_until_consolidated();
+        EXPECT_TRUE(bank_committed(WEAR_LEVELING_BANK_SIZE)) << "Bank should be committed";
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        EXPECT_EQ(read_all(), expected) << "Invalid readback after consolidation";
+    }
+}
+
+/**
+ * This test verifies that a damaged newest bank is ignored in favour of the previous one.
+ */
+TEST_F(WearLevelingDualBank, DamagedNewestBank_FallsBack) {
+    auto&     inst     = MockBackingStore::Instance();
+    logical_t expected = {};
+    fill_to_threshold(expected);
+    run_until_consolidated();
+
+    // Second consolidation back into the first bank
+    fill_to_threshold(expected);
+    run_until_consolidated();
+    EXPECT_TRUE(bank_committed(0)) << "Bank should be committed";
+
+    // Corrupt the consolidated data of the newest bank, without touching its commit marker
+    (inst.storage_begin() + 0)->erase();
+    (inst.storage_begin() + 0)->set(~(backing_store_int_t)0x5555);
+
+    // Falls back to the previous bank, whose write log still holds everything written since it was consolidated
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(read_all(), expected) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that if the task is never invoked, a full write log is consolidated in-line without data loss.
+ */
+TEST_F(WearLevelingDualBank, FullLog_ConsolidatesInline) {
+    auto&     inst         = MockBackingStore::Instance();
+    logical_t expected     = {};
+    bool      consolidated = false;
+
+    for (int i = 0; i < 64 && !consolidated; ++i) {
+        expected[i % expected.size()] = (std::uint8_t)(i + 1);
+        wear_leveling_status_t ret    = wear_leveling_write(i % expected.size(), &expected[i % expected.size()], 1);
+        EXPECT_NE(ret, WEAR_LEVELING_FAILED) << "Write failed";
+        consolidated = ret == WEAR_LEVELING_CONSOLIDATED;
+    }
+
+    EXPECT_TRUE(consolidated) << "Write log should have been consolidated";
+    EXPECT_EQ(inst.erase_range_invoke_count(), erase_steps) << "Only the idle bank should have been erased";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Full erase should never be used";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(read_all(), expected) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that erasing resets to the first bank.
+ */
+TEST_F(WearLevelingDualBank, Erase_ResetsBanks) {
+    logical_t expected = {};
+    fill_to_threshold(expected);
+    run_until_consolidated();
+
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    EXPECT_EQ(read_all(), logical_t{}) << "Invalid readback after erase";
+
+    uint8_t value = 0x34;
+    EXPECT_EQ(wear_leveling_write(0x02, &value, 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    logical_t actual = read_all();
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i], i == 0x02 ? 0x34 : 0x00) << "Invalid readback at " << i;
+    }
+}
+
+/**
+ * This test verifies random writes, background steps and power losses against a reference copy of the data.
+ */
+TEST_F(WearLevelingDualBank, Randomised_MatchesReference) {
+    std::mt19937 rng(0x51DE);
+    logical_t    expected = {};
+
+    for (int i = 0; i < 5000; ++i) {
+        switch (rng() % 8) {
+            case 0:
+                EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+                break;
+            case 1:
+            case 2:
+            case 3:
+                EXPECT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Task failed";
+                break;
+            default: {
+                std::size_t length  = 1 + rng() % 4;
+                std::size_t address = rng() % (expected.size() - length + 1);
+                for (std::size_t j = 0; j < length; ++j) {
+                    expected[address + j] = (std::uint8_t)(rng() % 3);
+                }
+                EXPECT_NE(wear_leveling_write(address, &expected[address], length), WEAR_LEVELING_FAILED) << "Write failed";
+            } break;
+        }
+        ASSERT_EQ(read_all(), expected) << "Invalid readback at iteration " << i;
+    }
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(read_all(), expected) << "Invalid readback after re-init";
+}
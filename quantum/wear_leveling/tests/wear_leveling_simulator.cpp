@@ -0,0 +1,221 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Throughput and endurance simulation of the wear-leveling algorithm.
+//
+// Each trace generates a day's worth of typical EEPROM traffic, which is replayed for WEAR_LEVELING_SIM_DAYS days with
+// the background task running between user actions. The results are printed, and recorded as test properties so they
+// end up in gtest's XML/JSON output:
+//   - backing store writes per logical write
+//   - bytes written to the backing store per logical byte written
+//   - consolidations (erase operations) per day
+//   - projected lifetime of the backing store, given its erase endurance
+//   - worst-case time spent in a single write, and in a single background task invocation
+//
+// Timings and endurance default to conservative figures for STM32 embedded flash, and can be overridden through the
+// target's DEFS along with the wear-leveling configuration itself to size a particular board.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+#include "test_metrics.hpp"
+
+extern "C" {
+#include "eeconfig.h"
+void advance_time(uint32_t ms);
+}
+
+#ifndef WEAR_LEVELING_SIM_DAYS
+#    define WEAR_LEVELING_SIM_DAYS 30
+#endif
+// Time taken by a single backing store write
+#ifndef WEAR_LEVELING_SIM_WRITE_US
+#    define WEAR_LEVELING_SIM_WRITE_US 60
+#endif
+// Time taken to erase 1kB of the backing store
+#ifndef WEAR_LEVELING_SIM_ERASE_US_PER_KB
+#    define WEAR_LEVELING_SIM_ERASE_US_PER_KB 20000
+#endif
+// Number of erase cycles the backing store is rated for
+#ifndef WEAR_LEVELING_SIM_ENDURANCE
+#    define WEAR_LEVELING_SIM_ENDURANCE 10000
+#endif
+// Time between user actions, and how often the background task is run in the meantime
+#ifndef WEAR_LEVELING_SIM_IDLE_MS
+#    define WEAR_LEVELING_SIM_IDLE_MS 1000
+#endif
+#ifndef WEAR_LEVELING_SIM_TASK_INTERVAL_MS
+#    define WEAR_LEVELING_SIM_TASK_INTERVAL_MS 10
+#endif
+
+// Default dynamic keymap layout, see quantum/dynamic_keymap.c
+static constexpr std::uint32_t KEYMAP_START = EECONFIG_SIZE;
+static constexpr std::uint32_t KEYMAP_KEYS  = 4 * 64;
+static constexpr std::uint32_t MACRO_START  = KEYMAP_START + KEYMAP_KEYS * 2;
+static constexpr std::uint32_t MACRO_SIZE   = WEAR_LEVELING_LOGICAL_SIZE - MACRO_START;
+
+static_assert(MACRO_START + 128 <= WEAR_LEVELING_LOGICAL_SIZE, "Logical size too small for the simulated dynamic keymap");
+
+// A single user action, as the sequence of EEPROM writes it results in
+struct SimWrite {
+    std::uint32_t             address;
+    std::vector<std::uint8_t> data;
+};
+using SimAction = std::vector<SimWrite>;
+using SimTrace  = std::function<std::vector<SimAction>(std::mt19937&)>;
+
+// VIA changing a single keycode, written a byte at a time by dynamic_keymap_set_keycode()
+static SimAction keymap_edit(std::mt19937& rng) {
+    std::uint32_t address = KEYMAP_START + 2 * (rng() % KEYMAP_KEYS);
+    std::uint16_t keycode = rng() % 0x5FFF;
+    return {{address, {(std::uint8_t)(keycode >> 8)}}, {address + 1, {(std::uint8_t)keycode}}};
+}
+
+// Stepping the RGB mode forwards or backwards, persisted as a whole by eeconfig_update_rgblight()
+static SimAction rgb_step(std::mt19937& rng) {
+    static std::uint8_t mode = 1;
+    mode                     = (mode - 1 + (rng() % 2 ? 1 : 39)) % 40 + 1;
+    return {{(std::uint32_t)(uintptr_t)EECONFIG_RGBLIGHT, {(std::uint8_t)(mode << 2 | 1), 0x00, 0xFF, 0xFF}}};
+}
+
+// Cycling the unicode input mode
+static SimAction unicode_mode(std::mt19937& rng) {
+    return {{(std::uint32_t)(uintptr_t)EECONFIG_UNICODEMODE, {(std::uint8_t)(rng() % 6)}}};
+}
+
+// VIA uploading the macro buffer, written a byte at a time by dynamic_keymap_macro_set_buffer()
+static SimAction macro_upload(std::mt19937& rng) {
+    SimAction     action;
+    std::uint32_t length = 64 + rng() % (std::min<std::uint32_t>(MACRO_SIZE, 256) - 64);
+    for (std::uint32_t i = 0; i < length; ++i) {
+        action.push_back({MACRO_START + i, {(std::uint8_t)(i % 16 == 15 ? 0 : 0x20 + rng() % 0x5F)}});
+    }
+    return action;
+}
+
+static SimTrace repeat(std::function<SimAction(std::mt19937&)> action, int per_day) {
+    return [action, per_day](std::mt19937& rng) {
+        std::vector<SimAction> day;
+        for (int i = 0; i < per_day; ++i) {
+            day.push_back(action(rng));
+        }
+        return day;
+    };
+}
+
+struct SimStats {
+    std::uint64_t writes;
+    std::uint64_t logical_bytes;
+    std::uint64_t backing_writes;
+    std::uint64_t erased_bytes;
+    std::uint64_t consolidations;
+    std::uint64_t worst_write_us;
+    std::uint64_t worst_task_us;
+};
+
+class WearLevelingSimulator : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+
+    // Simulated time spent in the backing store since the supplied counters were taken
+    static std::uint64_t elapsed_us(std::uint64_t writes, std::uint64_t erased_bytes) {
+        auto& inst = MockBackingStore::Instance();
+        return (inst.total_write_count() - writes) * (WEAR_LEVELING_SIM_WRITE_US) + (inst.total_erased_bytes() - erased_bytes) * (WEAR_LEVELING_SIM_ERASE_US_PER_KB) / 1024;
+    }
+
+    void simulate(const std::string& name, SimTrace trace) {
+        auto&                     inst     = MockBackingStore::Instance();
+        SimStats                  stats    = {};
+        std::vector<std::uint8_t> expected(WEAR_LEVELING_LOGICAL_SIZE, 0);
+        std::mt19937              rng(0x5EED);
+
+        for (int day = 0; day < (WEAR_LEVELING_SIM_DAYS); ++day) {
+            for (auto& action : trace(rng)) {
+                for (auto& write : action) {
+                    std::uint64_t writes       = inst.total_write_count();
+                    std::uint64_t erased_bytes = inst.total_erased_bytes();
+                    std::copy(write.data.begin(), write.data.end(), expected.begin() + write.address);
+                    ASSERT_NE(wear_leveling_write(write.address, write.data.data(), write.data.size()), WEAR_LEVELING_FAILED) << "Write failed";
+                    stats.worst_write_us = std::max(stats.worst_write_us, elapsed_us(writes, erased_bytes));
+                    stats.writes += 1;
+                    stats.logical_bytes += write.data.size();
+                }
+
+                for (int t = 0; t < (WEAR_LEVELING_SIM_IDLE_MS); t += (WEAR_LEVELING_SIM_TASK_INTERVAL_MS)) {
+                    advance_time(WEAR_LEVELING_SIM_TASK_INTERVAL_MS);
+                    std::uint64_t writes       = inst.total_write_count();
+                    std::uint64_t erased_bytes = inst.total_erased_bytes();
+                    ASSERT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Task failed";
+                    stats.worst_task_us = std::max(stats.worst_task_us, elapsed_us(writes, erased_bytes));
+                }
+            }
+        }
+
+        stats.backing_writes = inst.total_write_count();
+        stats.erased_bytes   = inst.total_erased_bytes();
+#ifdef WEAR_LEVELING_DUAL_BANK
+        // Background consolidations erase the idle bank in several ranged erases
+        stats.consolidations = inst.erase_invoke_count() + inst.erase_range_invoke_count() / ((WEAR_LEVELING_BANK_SIZE) / (WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE));
+#else
+        stats.consolidations = inst.erase_invoke_count() + inst.erase_range_invoke_count();
+#endif
+
+        // Every erase operation wears the erased area once, spread over the whole backing store
+        double days_cycles    = (double)stats.erased_bytes / (WEAR_LEVELING_BACKING_SIZE) / (WEAR_LEVELING_SIM_DAYS);
+        double lifetime_years = days_cycles > 0 ? (WEAR_LEVELING_SIM_ENDURANCE) / days_cycles / 365 : INFINITY;
+
+        TestMetrics("WEAR", name)
+            .add("writes_per_day", (double)stats.writes / (WEAR_LEVELING_SIM_DAYS))
+            .add("backing_writes_per_write", (double)stats.backing_writes / stats.writes)
+            .add("bytes_per_logical_byte", (double)(stats.backing_writes * (BACKING_STORE_WRITE_SIZE)) / stats.logical_bytes)
+            .add("consolidations_per_day", (double)stats.consolidations / (WEAR_LEVELING_SIM_DAYS))
+            .add("lifetime_years", lifetime_years)
+            .add("worst_write_ms", stats.worst_write_us / 1000.0)
+            .add("worst_task_ms", stats.worst_task_us / 1000.0)
+            .report();
+
+        // Everything written has to survive a power cycle
+        ASSERT_NE(wear_leveling_flush(), WEAR_LEVELING_FAILED) << "Flush failed";
+        ASSERT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        std::vector<std::uint8_t> actual(WEAR_LEVELING_LOGICAL_SIZE, 0);
+        ASSERT_EQ(wear_leveling_read(0, actual.data(), actual.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_EQ(actual, expected) << "Invalid readback after re-init";
+    }
+};
+
+TEST_F(WearLevelingSimulator, KeymapEdits) {
+    simulate("keymap_edits", repeat(keymap_edit, 50));
+}
+
+TEST_F(WearLevelingSimulator, RgbModeCycling) {
+    simulate("rgb_mode_cycling", repeat(rgb_step, 200));
+}
+
+TEST_F(WearLevelingSimulator, UnicodeMode) {
+    simulate("unicode_mode", repeat(unicode_mode, 10));
+}
+
+TEST_F(WearLevelingSimulator, DynamicMacros) {
+    simulate("dynamic_macros", repeat(macro_upload, 5));
+}
+
+TEST_F(WearLevelingSimulator, Mixed) {
+    simulate("mixed", [](std::mt19937& rng) {
+        std::vector<SimAction> day;
+        for (auto& trace : {repeat(keymap_edit, 50), repeat(rgb_step, 200), repeat(unicode_mode, 10), repeat(macro_upload, 5)}) {
+            auto actions = trace(rng);
+            day.insert(day.end(), actions.begin(), actions.end());
+        }
+        std::shuffle(day.begin(), day.end(), rng);
+        return day;
+    });
+}
@@ -0,0 +1,225 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <array>
+#include <functional>
+#include <random>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+#include "test_metrics.hpp"
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+using logical_t = std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE>;
+
+class WearLevelingWriteCombining : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+    }
+
+    logical_t read_all() {
+        logical_t values;
+        EXPECT_EQ(wear_leveling_read(0, values.data(), values.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        return values;
+    }
+
+    // Lets writes settle, so that the task flushes them
+    void idle() {
+        advance_time(WEAR_LEVELING_WRITE_COMBINING_DELAY);
+        EXPECT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Task failed";
+    }
+};
+
+/**
+ * This test verifies that writes are held back until they have settled, while still being visible to reads.
+ */
+TEST_F(WearLevelingWriteCombining, WritesDeferredUntilIdle) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t value = 0x42;
+    EXPECT_EQ(wear_leveling_write(0x80, &value, 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should have been deferred";
+    EXPECT_EQ(read_all()[0x80], 0x42) << "Deferred write should be readable";
+
+    // Each write restarts the delay
+    advance_time(WEAR_LEVELING_WRITE_COMBINING_DELAY - 1);
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    value = 0x43;
+    EXPECT_EQ(wear_leveling_write(0x81, &value, 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    advance_time(WEAR_LEVELING_WRITE_COMBINING_DELAY - 1);
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should still be deferred";
+
+    advance_time(1);
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 3) << "Both bytes should have been written as a single multi-byte entry";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(read_all()[0x80], 0x42) << "Invalid readback after re-init";
+    EXPECT_EQ(read_all()[0x81], 0x43) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that adjacent single-byte writes are combined into full multi-byte log entries.
+ */
+TEST_F(WearLevelingWriteCombining, AdjacentWritesCombined) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (uint8_t i = 0; i < LOG_ENTRY_MULTIBYTE_MAX_BYTES * 4; ++i) {
+        uint8_t value = 0x10 + i;
+        EXPECT_EQ(wear_leveling_write(0x80 + i, &value, 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+
+    // 4 full multi-byte entries, each of which is 4x 2-byte writes
+    EXPECT_EQ(inst.write_invoke_count(), 4 * 4) << "Unexpected number of backing store writes";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    logical_t actual = read_all();
+    for (uint8_t i = 0; i < LOG_ENTRY_MULTIBYTE_MAX_BYTES * 4; ++i) {
+        EXPECT_EQ(actual[0x80 + i], 0x10 + i) << "Invalid readback at " << (int)i;
+    }
+}
+
+/**
+ * This test verifies that repeated writes to the same location only result in the final value being logged.
+ */
+TEST_F(WearLevelingWriteCombining, OverwritesCombined) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (uint16_t i = 2; i < 100; ++i) {
+        EXPECT_EQ(wear_leveling_write(0x90, &i, sizeof(i)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 3) << "Only a single 2-byte multi-byte entry should have been written";
+
+    // Nothing left to flush
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 3) << "Second flush should not have written";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    uint16_t value;
+    EXPECT_EQ(wear_leveling_read(0x90, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(value, 99) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that more scattered writes than there are dirty ranges are all retained.
+ */
+TEST_F(WearLevelingWriteCombining, ScatteredWritesRetained) {
+    logical_t expected = {};
+    for (std::size_t i = 0; i < WEAR_LEVELING_WRITE_COMBINING_RANGES * 3; ++i) {
+        std::size_t address = (i * 37) % expected.size();
+        expected[address]   = (std::uint8_t)(i + 1);
+        EXPECT_EQ(wear_leveling_write(address, &expected[address], 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(read_all(), expected) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that erasing discards any held back writes.
+ */
+TEST_F(WearLevelingWriteCombining, EraseDiscardsPending) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t value = 0x42;
+    EXPECT_EQ(wear_leveling_write(0x80, &value, 1), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Nothing should have been written";
+    EXPECT_EQ(read_all(), logical_t{}) << "Invalid readback after erase";
+}
+
+/**
+ * This test verifies random writes, flushes and power losses against a reference copy of the data, including writes
+ * which were never flushed being lost.
+ */
+TEST_F(WearLevelingWriteCombining, Randomised_MatchesReference) {
+    std::mt19937 rng(0xC0DE);
+    logical_t    flushed  = {};
+    logical_t    expected = {};
+
+    for (int i = 0; i < 5000; ++i) {
+        switch (rng() % 16) {
+            case 0:
+                EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+                expected = flushed;
+                break;
+            case 1:
+                EXPECT_NE(wear_leveling_flush(), WEAR_LEVELING_FAILED) << "Flush failed";
+                flushed = expected;
+                break;
+            case 2:
+                idle();
+                flushed = expected;
+                break;
+            default: {
+                std::size_t length  = 1 + rng() % 8;
+                std::size_t address = rng() % (expected.size() - length + 1);
+                for (std::size_t j = 0; j < length; ++j) {
+                    expected[address + j] = (std::uint8_t)(rng() % 4);
+                }
+                EXPECT_NE(wear_leveling_write(address, &expected[address], length), WEAR_LEVELING_FAILED) << "Write failed";
+            } break;
+        }
+        ASSERT_EQ(read_all(), expected) << "Invalid readback at iteration " << i;
+    }
+}
+
+/**
+ * Replays bursts of typical EEPROM traffic -- a VIA keymap upload, which writes byte-by-byte, followed by cycling
+ * through RGB modes, which rewrites the same config repeatedly -- and compares log growth and erases against logging
+ * every write as it happens.
+ */
+TEST_F(WearLevelingWriteCombining, MeasureLogGrowthAndErasures) {
+    auto& inst = MockBackingStore::Instance();
+
+    struct result_t {
+        std::uint64_t backing_writes;
+        std::uint64_t erasures;
+    };
+
+    auto replay = [&](std::function<void()> after_write) -> result_t {
+        inst.reset_instance();
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+
+        logical_t expected = {};
+        for (int burst = 0; burst < 50; ++burst) {
+            // Keymap upload
+            for (std::size_t i = 0; i < 128; ++i) {
+                expected[0x40 + i] = (std::uint8_t)(burst * 7 + i);
+                EXPECT_NE(wear_leveling_write(0x40 + i, &expected[0x40 + i], 1), WEAR_LEVELING_FAILED) << "Write failed";
+                after_write();
+            }
+            // RGB mode cycling
+            for (std::uint8_t mode = 0; mode < 10; ++mode) {
+                std::uint32_t config = 0x01000000 | (std::uint32_t)(mode + burst) << 8 | 0x01;
+                memcpy(&expected[0x10], &config, sizeof(config));
+                EXPECT_NE(wear_leveling_write(0x10, &config, sizeof(config)), WEAR_LEVELING_FAILED) << "Write failed";
+                after_write();
+            }
+            idle();
+        }
+
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        EXPECT_EQ(read_all(), expected) << "Invalid readback after re-init";
+        return {inst.total_write_count(), inst.erasure_count()};
+    };
+
+    result_t immediate = replay([]() { wear_leveling_flush(); });
+    result_t combined  = replay([]() {});
+
+    for (const auto& run : {std::make_pair("immediate", immediate), std::make_pair("combined", combined)}) {
+        TestMetrics("WEAR", run.first).add("log_bytes", run.second.backing_writes * BACKING_STORE_WRITE_SIZE).add("erasures", run.second.erasures).report();
+    }
+
+    EXPECT_LT(combined.backing_writes * 2, immediate.backing_writes) << "Write combining should at least halve log growth";
+    EXPECT_LT(combined.erasures * 2, immediate.erasures) << "Write combining should at least halve erasures";
+}
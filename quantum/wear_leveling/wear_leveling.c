@@ -4,6 +4,9 @@
 #include "fnv.h"
 #include "wear_leveling.h"
 #include "wear_leveling_internal.h"
+#ifdef WEAR_LEVELING_WRITE_COMBINING
+#    include "timer.h"
+#endif
 
 /*
     This wear leveling algorithm is adapted from algorithms from previous
@@ -153,7 +156,56 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Dual-bank layout (WEAR_LEVELING_DUAL_BANK):
+
+        The backing store is split into two equally-sized banks, each laid out
+        as above with an additional 8 bytes following the FNV1a_64, holding the
+        generation of the bank. The generation is written last, with its final
+        backing store write containing a commit marker, so a bank only becomes
+        valid once everything before it has been written. On startup, the
+        valid bank with the newest generation is used.
+
+        Once the write log of the active bank passes the consolidation
+        threshold, wear_leveling_task() erases the idle bank one
+        WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE at a time, then copies the cache
+        into it a few words at a time. Writes to logical data that the
+        copy has already passed over are logged in both banks. After the copy
+        completes, the checksum and generation are written and the idle bank
+        becomes the active one. The previously-active bank is left intact until
+        the next consolidation erases it, so a power loss at any point leaves a
+        complete bank behind.
+
+        If the write log of the active bank fills up before the copy has
+        completed, the remainder of the consolidation is performed in-line.
+
+    Write combining (WEAR_LEVELING_WRITE_COMBINING):
+
+        Writes only update the cache, and the written range is recorded in a
+        small table of dirty ranges. Overlapping or adjacent ranges are merged,
+        and if the table is full, a new range is merged with the nearest one.
+        Dirty ranges are logged, as multi-byte entries where possible, once no
+        writes have occurred for WEAR_LEVELING_WRITE_COMBINING_DELAY
+        milliseconds, or on an explicit wear_leveling_flush(). Anything written
+        since the last flush is lost on power loss. */
+
+#ifdef WEAR_LEVELING_DUAL_BANK
+/**
+ * Marker stored in the last byte of the generation entry, once the bank is complete.
+ */
+#    define WEAR_LEVELING_BANK_COMMITTED 0x5A
+
+/**
+ * Progress of the consolidation into the idle bank.
+ */
+typedef enum wear_leveling_consolidation_state_t {
+    CONSOLIDATION_IDLE,   //< No consolidation in progress
+    CONSOLIDATION_ERASE,  //< The idle bank is being erased
+    CONSOLIDATION_COPY,   //< The cache is being copied into the idle bank
+    CONSOLIDATION_COMMIT, //< The copy is complete, the checksum and generation need to be written
+} wear_leveling_consolidation_state_t;
+#endif // WEAR_LEVELING_DUAL_BANK
 
 /**
  * Storage area for the wear-leveling cache.
@@ -161,7 +213,27 @@
 static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
+    uint32_t                                                       bank_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_WRITE_COMBINING
+    struct {
+        uint32_t start;
+        uint32_t end;
+    } dirty[(WEAR_LEVELING_WRITE_COMBINING_RANGES)];
+    uint8_t  dirty_count;
+    uint32_t last_write;
+#endif // WEAR_LEVELING_WRITE_COMBINING
+#ifdef WEAR_LEVELING_DUAL_BANK
+    uint32_t generation;
+    struct {
+        wear_leveling_consolidation_state_t state;
+        uint32_t                            bank_address;  // start of the bank being written
+        uint32_t                            write_address; // next write log location in the bank being written
+        uint32_t                            offset;        // next byte of the idle bank to be erased, or of the cache to be copied
+        uint64_t                            checksum;      // FNV1a_64 of the bytes copied so far
+        bool                                mirroring;     // writes are currently going to the bank being written
+    } consolidation;
+#endif // WEAR_LEVELING_DUAL_BANK
 } wear_leveling;
 
 /**
@@ -202,7 +274,33 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.write_address = wear_leveling.bank_address + (WEAR_LEVELING_LOG_OFFSET);
+}
+
+/**
+ * Reads an 8-byte entry, such as the FNV1a_64 of the consolidated data, from the backing store.
+ */
+static bool wear_leveling_read_entry(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_read_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_read_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_read(address, &entry->raw64);
+#endif
+}
+
+/**
+ * Writes an 8-byte entry, such as the FNV1a_64 of the consolidated data, to the backing store.
+ */
+static bool wear_leveling_write_entry(uint32_t address, write_log_entry_t *entry) {
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry->raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry->raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry->raw64);
+#endif
 }
 
 /**
@@ -213,7 +311,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     wl_dprintf("Reading consolidated data\n");
 
     wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_read_bulk(wear_leveling.bank_address, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to read from backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -223,13 +321,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
         uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         write_log_entry_t entry;
         wl_dprintf("Reading checksum\n");
-#if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
-#elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
-#elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
-#endif
+        wear_leveling_read_entry(wear_leveling.bank_address + (WEAR_LEVELING_LOGICAL_SIZE), &entry);
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
         if (entry.raw64 == expected) {
@@ -248,6 +340,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     return status;
 }
 
+#ifndef WEAR_LEVELING_DUAL_BANK
 /**
  * Writes the current cache to consolidated data at the beginning of the backing store.
  * Does not clear the write log.
@@ -268,24 +361,9 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
         write_log_entry_t entry;
         entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#endif
-        } while (0);
+        if (!wear_leveling_write_entry((WEAR_LEVELING_LOGICAL_SIZE), &entry)) {
+            status = WEAR_LEVELING_FAILED;
+        }
     }
 
     if (lock_status == STATUS_SUCCESS) {
@@ -316,20 +394,145 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = (WEAR_LEVELING_LOG_OFFSET);
+
+    return status;
+}
+
+#else  // WEAR_LEVELING_DUAL_BANK
+
+/**
+ * Writes the generation of the bank being consolidated into, followed by the commit marker.
+ * The marker is written separately so that the bank cannot appear valid before the generation has been written in full.
+ */
+static bool wear_leveling_write_generation(uint32_t address, uint32_t generation) {
+    write_log_entry_t entry = {.raw32 = {generation, 0}};
+    entry.raw8[7]           = WEAR_LEVELING_BANK_COMMITTED;
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry.raw16, 3) && backing_store_write(address + 6, entry.raw16[3]);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write(address, entry.raw32[0]) && backing_store_write(address + 4, entry.raw32[1]);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry.raw64);
+#endif
+}
+
+/**
+ * Starts consolidating the cache into the idle bank, if not already in progress.
+ */
+static void wear_leveling_consolidate_start(void) {
+    if (wear_leveling.consolidation.state == CONSOLIDATION_IDLE) {
+        wl_dprintf("Starting consolidation\n");
+        wear_leveling.consolidation.state        = CONSOLIDATION_ERASE;
+        wear_leveling.consolidation.bank_address = (wear_leveling.bank_address + (WEAR_LEVELING_BANK_SIZE)) % (WEAR_LEVELING_BACKING_SIZE);
+        wear_leveling.consolidation.offset       = 0;
+    }
+}
 
+/**
+ * Performs the next step of the consolidation into the idle bank, erasing WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE bytes
+ * of the idle bank or copying at most `length` bytes of the cache.
+ * On failure, the consolidation is abandoned and needs to be started over.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED once the idle bank has become the active bank
+ */
+static wear_leveling_status_t wear_leveling_consolidate_step(size_t length) {
+    const uint32_t bank_address = wear_leveling.consolidation.bank_address;
+    bool           ok           = true;
+
+    switch (wear_leveling.consolidation.state) {
+        case CONSOLIDATION_IDLE:
+            return WEAR_LEVELING_SUCCESS;
+
+        case CONSOLIDATION_ERASE:
+            wl_dprintf("Erasing idle bank at offset %d\n", (int)wear_leveling.consolidation.offset);
+            ok = backing_store_erase_range(bank_address + wear_leveling.consolidation.offset, (WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE));
+            if (ok) {
+                wear_leveling.consolidation.offset += (WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE);
+                if (wear_leveling.consolidation.offset == (WEAR_LEVELING_BANK_SIZE)) {
+                    wear_leveling.consolidation.state         = CONSOLIDATION_COPY;
+                    wear_leveling.consolidation.write_address = bank_address + (WEAR_LEVELING_LOG_OFFSET);
+                    wear_leveling.consolidation.offset        = 0;
+                    wear_leveling.consolidation.checksum      = FNV1A_64_INIT;
+                }
+            }
+            break;
+
+        case CONSOLIDATION_COPY: {
+            const uint32_t offset = wear_leveling.consolidation.offset;
+            if (length > (WEAR_LEVELING_LOGICAL_SIZE)-offset) {
+                length = (WEAR_LEVELING_LOGICAL_SIZE)-offset;
+            }
+            ok = backing_store_write_bulk(bank_address + offset, (backing_store_int_t *)&wear_leveling.cache[offset], length / sizeof(backing_store_int_t));
+            if (ok) {
+                wear_leveling.consolidation.checksum = fnv_64a_buf(&wear_leveling.cache[offset], length, wear_leveling.consolidation.checksum);
+                wear_leveling.consolidation.offset += length;
+                if (wear_leveling.consolidation.offset == (WEAR_LEVELING_LOGICAL_SIZE)) {
+                    wear_leveling.consolidation.state = CONSOLIDATION_COMMIT;
+                }
+            }
+        } break;
+
+        case CONSOLIDATION_COMMIT: {
+            wl_dprintf("Committing bank\n");
+            write_log_entry_t entry = {.raw64 = wear_leveling.consolidation.checksum};
+            ok                      = wear_leveling_write_entry(bank_address + (WEAR_LEVELING_LOGICAL_SIZE), &entry) && wear_leveling_write_generation(bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8, wear_leveling.generation + 1);
+            if (ok) {
+                // The idle bank is now the newest complete bank, any further writes to the log go there
+                wear_leveling.consolidation.state = CONSOLIDATION_IDLE;
+                wear_leveling.generation += 1;
+                wear_leveling.bank_address  = bank_address;
+                wear_leveling.write_address = wear_leveling.consolidation.write_address;
+                return WEAR_LEVELING_CONSOLIDATED;
+            }
+        } break;
+    }
+
+    if (!ok) {
+        wl_dprintf("Failed to consolidate into idle bank\n");
+        wear_leveling.consolidation.state = CONSOLIDATION_IDLE;
+        return WEAR_LEVELING_FAILED;
+    }
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Forces the consolidation of the current cache into the idle bank to complete in-line.
+ * The active bank is left untouched, so a power loss during this operation does not lose data.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    wear_leveling_status_t      status      = WEAR_LEVELING_FAILED;
+    if (lock_status != STATUS_FAILURE) {
+        wear_leveling_consolidate_start();
+        do {
+            status = wear_leveling_consolidate_step(WEAR_LEVELING_LOGICAL_SIZE);
+        } while (status == WEAR_LEVELING_SUCCESS);
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
     return status;
 }
 
+#endif // WEAR_LEVELING_DUAL_BANK
+
 /**
  * Potential write of the current cache to the backing store.
- * Skipped if the current write log position is not at the end of the backing store.
- * During this operation, there is the potential for data loss if a power loss occurs.
+ * Skipped if the current write log position is not at the end of the active bank.
+ * Without WEAR_LEVELING_DUAL_BANK, there is the potential for data loss if a power loss occurs during this operation.
  *
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
+#ifdef WEAR_LEVELING_DUAL_BANK
+    // Writes being mirrored into the bank under consolidation never trigger consolidation themselves
+    if (wear_leveling.consolidation.mirroring) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+#endif // WEAR_LEVELING_DUAL_BANK
+    if (wear_leveling.write_address >= wear_leveling.bank_address + (WEAR_LEVELING_BANK_SIZE)) {
         return wear_leveling_consolidate_force();
     }
 
@@ -469,6 +672,34 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+/**
+ * Logs the write in the bank under consolidation as well, once copying of the cache has started. All writes need to be
+ * logged, not just those to areas already copied, so that playback of the log applies them in order.
+ * This happens before the write to the active bank, as that may complete the consolidation in-line.
+ */
+static wear_leveling_status_t wear_leveling_write_mirror(uint32_t address, const void *value, size_t length) {
+    if (wear_leveling.consolidation.state != CONSOLIDATION_COPY && wear_leveling.consolidation.state != CONSOLIDATION_COMMIT) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Temporarily direct the write log to the bank under consolidation
+    const uint32_t write_address              = wear_leveling.write_address;
+    wear_leveling.write_address               = wear_leveling.consolidation.write_address;
+    wear_leveling.consolidation.mirroring     = true;
+    wear_leveling_status_t status             = wear_leveling_write_raw(address, value, length);
+    wear_leveling.consolidation.mirroring     = false;
+    wear_leveling.consolidation.write_address = wear_leveling.write_address;
+    wear_leveling.write_address               = write_address;
+
+    if (status == WEAR_LEVELING_FAILED) {
+        wl_dprintf("Failed to write to idle bank, abandoning consolidation\n");
+        wear_leveling.consolidation.state = CONSOLIDATION_IDLE;
+    }
+    return status;
+}
+#endif // WEAR_LEVELING_DUAL_BANK
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
@@ -477,8 +708,8 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+    uint32_t               address         = wear_leveling.bank_address + (WEAR_LEVELING_LOG_OFFSET);
+    while (!cancel_playback && address < wear_leveling.bank_address + (WEAR_LEVELING_BANK_SIZE)) {
         backing_store_int_t value;
         bool                ok = backing_store_read(address, &value);
         if (!ok) {
@@ -611,6 +842,60 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+/**
+ * Determines whether the bank at the supplied address has been committed, and if so, its generation.
+ */
+static bool wear_leveling_bank_committed(uint32_t bank_address, uint32_t *generation) {
+    write_log_entry_t entry;
+    if (!wear_leveling_read_entry(bank_address + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &entry) || entry.raw8[7] != WEAR_LEVELING_BANK_COMMITTED) {
+        return false;
+    }
+    *generation = entry.raw32[0];
+    return true;
+}
+
+/**
+ * Determines whether the consolidated data of the bank at the supplied address matches its checksum.
+ * Uses the cache as scratch space.
+ */
+static bool wear_leveling_bank_intact(uint32_t bank_address) {
+    write_log_entry_t entry;
+    if (!backing_store_read_bulk(bank_address, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t)) || !wear_leveling_read_entry(bank_address + (WEAR_LEVELING_LOGICAL_SIZE), &entry)) {
+        return false;
+    }
+    return entry.raw64 == fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+}
+
+/**
+ * Selects the active bank -- the intact, committed bank with the newest generation.
+ * If there is none, such as after an erase, the first bank is used.
+ */
+static void wear_leveling_select_bank(void) {
+    uint32_t generation[2];
+    bool     committed[2] = {
+        wear_leveling_bank_committed(0, &generation[0]),
+        wear_leveling_bank_committed((WEAR_LEVELING_BANK_SIZE), &generation[1]),
+    };
+
+    // Prefer the newer bank, but fall back to the older one if the newer one turns out to be damaged
+    int newest = (committed[1] && (!committed[0] || (int32_t)(generation[1] - generation[0]) > 0)) ? 1 : 0;
+
+    wear_leveling.bank_address        = 0;
+    wear_leveling.generation          = 0;
+    wear_leveling.consolidation.state = CONSOLIDATION_IDLE;
+    for (int i = 0; i < 2; ++i) {
+        int bank = i == 0 ? newest : 1 - newest;
+        if (committed[bank] && wear_leveling_bank_intact(bank * (WEAR_LEVELING_BANK_SIZE))) {
+            wl_dprintf("Using bank %d, generation %lu\n", bank, (unsigned long)generation[bank]);
+            wear_leveling.bank_address = bank * (WEAR_LEVELING_BANK_SIZE);
+            wear_leveling.generation   = generation[bank];
+            break;
+        }
+    }
+}
+#endif // WEAR_LEVELING_DUAL_BANK
+
 /**
  * Wear-leveling initialization
  */
@@ -619,6 +904,9 @@ wear_leveling_status_t wear_leveling_init(void) {
 
     // Reset the cache
     wear_leveling_clear_cache();
+#ifdef WEAR_LEVELING_WRITE_COMBINING
+    wear_leveling.dirty_count = 0;
+#endif // WEAR_LEVELING_WRITE_COMBINING
 
     // Initialise the backing store
     if (!backing_store_init()) {
@@ -627,6 +915,12 @@ wear_leveling_status_t wear_leveling_init(void) {
         return WEAR_LEVELING_FAILED;
     }
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+    // Work out which bank holds the latest data, abandoning any consolidation that was interrupted
+    wear_leveling_select_bank();
+    wear_leveling_clear_cache();
+#endif // WEAR_LEVELING_DUAL_BANK
+
     // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
     wear_leveling_status_t status = wear_leveling_read_consolidated();
     if (status == WEAR_LEVELING_FAILED) {
@@ -661,6 +955,14 @@ wear_leveling_status_t wear_leveling_erase(void) {
 
     // Perform the erase
     bool ret = backing_store_erase();
+#ifdef WEAR_LEVELING_DUAL_BANK
+    wear_leveling.bank_address        = 0;
+    wear_leveling.generation          = 0;
+    wear_leveling.consolidation.state = CONSOLIDATION_IDLE;
+#endif // WEAR_LEVELING_DUAL_BANK
+#ifdef WEAR_LEVELING_WRITE_COMBINING
+    wear_leveling.dirty_count = 0;
+#endif // WEAR_LEVELING_WRITE_COMBINING
     wear_leveling_clear_cache();
 
     // Lock the backing store if we acquired the lock successfully
@@ -671,6 +973,97 @@ wear_leveling_status_t wear_leveling_erase(void) {
     return ret ? WEAR_LEVELING_SUCCESS : WEAR_LEVELING_FAILED;
 }
 
+/**
+ * Writes the supplied range of the cache into the write log.
+ */
+static wear_leveling_status_t wear_leveling_commit(uint32_t address, size_t length) {
+    const uint8_t *value = &wear_leveling.cache[address];
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Perform the actual write
+#ifdef WEAR_LEVELING_DUAL_BANK
+    wear_leveling_status_t status = wear_leveling_write_mirror(address, value, length);
+    if (status == WEAR_LEVELING_SUCCESS) {
+        status = wear_leveling_write_raw(address, value, length);
+    }
+#else
+    wear_leveling_status_t status = wear_leveling_write_raw(address, value, length);
+#endif // WEAR_LEVELING_DUAL_BANK
+    switch (status) {
+        case WEAR_LEVELING_CONSOLIDATED:
+        case WEAR_LEVELING_FAILED:
+            // If the write triggered consolidation, or the write failed, then nothing else needs to occur.
+            break;
+
+        case WEAR_LEVELING_SUCCESS:
+            // Consolidate the cache + write log if required
+            status = wear_leveling_consolidate_if_needed();
+            break;
+
+        default:
+            // Unsure how we'd get here...
+            status = WEAR_LEVELING_FAILED;
+            break;
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+#ifdef WEAR_LEVELING_WRITE_COMBINING
+/**
+ * Records a range of the cache as needing to be written into the write log, merging it with any overlapping or
+ * adjacent ranges. If there's no space left, the range is merged with the nearest one instead.
+ */
+static void wear_leveling_mark_dirty(uint32_t start, uint32_t end) {
+    for (uint8_t i = 0; i < wear_leveling.dirty_count;) {
+        if (wear_leveling.dirty[i].start <= end && start <= wear_leveling.dirty[i].end) {
+            start = wear_leveling.dirty[i].start < start ? wear_leveling.dirty[i].start : start;
+            end   = wear_leveling.dirty[i].end > end ? wear_leveling.dirty[i].end : end;
+            // Swap in the last range and check this slot again
+            wear_leveling.dirty[i] = wear_leveling.dirty[--wear_leveling.dirty_count];
+        } else {
+            ++i;
+        }
+    }
+
+    if (wear_leveling.dirty_count == (WEAR_LEVELING_WRITE_COMBINING_RANGES)) {
+        // No ranges touch the new one at this point, so each is either entirely before or after it
+        uint8_t  nearest = 0;
+        uint32_t gap     = UINT32_MAX;
+        for (uint8_t i = 0; i < wear_leveling.dirty_count; ++i) {
+            uint32_t this_gap = wear_leveling.dirty[i].end < start ? start - wear_leveling.dirty[i].end : wear_leveling.dirty[i].start - end;
+            if (this_gap < gap) {
+                nearest = i;
+                gap     = this_gap;
+            }
+        }
+        start                        = wear_leveling.dirty[nearest].start < start ? wear_leveling.dirty[nearest].start : start;
+        end                          = wear_leveling.dirty[nearest].end > end ? wear_leveling.dirty[nearest].end : end;
+        wear_leveling.dirty[nearest] = wear_leveling.dirty[--wear_leveling.dirty_count];
+
+        // The merged range may now cover others
+        wear_leveling_mark_dirty(start, end);
+        return;
+    }
+
+    wear_leveling.dirty[wear_leveling.dirty_count].start = start;
+    wear_leveling.dirty[wear_leveling.dirty_count].end   = end;
+    ++wear_leveling.dirty_count;
+}
+#endif // WEAR_LEVELING_WRITE_COMBINING
+
 /**
  * Writes logical data into the backing store. Skips writes if there are no changes to values.
  */
@@ -691,6 +1084,27 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
+#ifdef WEAR_LEVELING_WRITE_COMBINING
+    // Defer the write to the backing store until writes have settled
+    wear_leveling_mark_dirty(address, address + (uint32_t)length);
+    wear_leveling.last_write = timer_read32();
+    return WEAR_LEVELING_SUCCESS;
+#else
+    return wear_leveling_commit(address, length);
+#endif // WEAR_LEVELING_WRITE_COMBINING
+}
+
+/**
+ * Writes any logical data held back by write combining into the backing store.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+#ifdef WEAR_LEVELING_WRITE_COMBINING
+    if (wear_leveling.dirty_count == 0) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Flush\n");
+
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -698,25 +1112,61 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return WEAR_LEVELING_FAILED;
     }
 
-    // Perform the actual write
-    wear_leveling_status_t status = wear_leveling_write_raw(address, value, length);
-    switch (status) {
-        case WEAR_LEVELING_CONSOLIDATED:
-        case WEAR_LEVELING_FAILED:
-            // If the write triggered consolidation, or the write failed, then nothing else needs to occur.
-            break;
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    while (wear_leveling.dirty_count > 0 && status == WEAR_LEVELING_SUCCESS) {
+        uint8_t i = wear_leveling.dirty_count - 1;
+        status    = wear_leveling_commit(wear_leveling.dirty[i].start, wear_leveling.dirty[i].end - wear_leveling.dirty[i].start);
+        if (status != WEAR_LEVELING_FAILED) {
+            wear_leveling.dirty_count = i;
+        }
+    }
 
-        case WEAR_LEVELING_SUCCESS:
-            // Consolidate the cache + write log if required
-            status = wear_leveling_consolidate_if_needed();
-            break;
+    // If consolidation occurred, the entire cache has been written out
+    if (status == WEAR_LEVELING_CONSOLIDATED) {
+        wear_leveling.dirty_count = 0;
+    }
 
-        default:
-            // Unsure how we'd get here...
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
             status = WEAR_LEVELING_FAILED;
-            break;
+        }
     }
 
+    return status;
+#else
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_WRITE_COMBINING
+}
+
+/**
+ * Background work: flushes combined writes once they have settled, and advances the consolidation into the idle bank,
+ * starting one once the write log is filling up.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+#ifdef WEAR_LEVELING_WRITE_COMBINING
+    if (wear_leveling.dirty_count > 0 && timer_elapsed32(wear_leveling.last_write) >= (WEAR_LEVELING_WRITE_COMBINING_DELAY)) {
+        wear_leveling_status_t status = wear_leveling_flush();
+        if (status != WEAR_LEVELING_SUCCESS) {
+            return status;
+        }
+    }
+#endif // WEAR_LEVELING_WRITE_COMBINING
+#ifdef WEAR_LEVELING_DUAL_BANK
+    if (wear_leveling.consolidation.state == CONSOLIDATION_IDLE) {
+        if (wear_leveling.write_address < wear_leveling.bank_address + (WEAR_LEVELING_LOG_OFFSET) + (WEAR_LEVELING_CONSOLIDATION_THRESHOLD)) {
+            return WEAR_LEVELING_SUCCESS;
+        }
+        wear_leveling_consolidate_start();
+    }
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_consolidate_step(WEAR_LEVELING_CONSOLIDATION_STEP_SIZE);
+
     if (lock_status == STATUS_SUCCESS) {
         if (wear_leveling_lock() == STATUS_FAILURE) {
             status = WEAR_LEVELING_FAILED;
@@ -724,6 +1174,9 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     }
 
     return status;
+#else
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_DUAL_BANK
 }
 
 /**
@@ -43,6 +43,15 @@ wear_leveling_status_t wear_leveling_erase(void);
  */
 wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value, size_t length);
 
+/**
+ * Writes any logical data held back by WEAR_LEVELING_WRITE_COMBINING into the backing store.
+ *
+ * Without write combining, all data has already been written and this does nothing.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
 /**
  * Reads logical data from the cache.
  *
@@ -52,3 +61,16 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Performs background work, to be called periodically.
+ *
+ * With WEAR_LEVELING_WRITE_COMBINING, this flushes held back data once no writes have occurred for
+ * WEAR_LEVELING_WRITE_COMBINING_DELAY milliseconds.
+ *
+ * With WEAR_LEVELING_DUAL_BANK, this advances the consolidation of the cache into the idle bank by at most
+ * WEAR_LEVELING_CONSOLIDATION_STEP_SIZE bytes, starting one once the write log is filling up.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_task(void);
@@ -66,10 +66,65 @@ _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
 
+#ifdef WEAR_LEVELING_DUAL_BANK
+// Each half of the backing store holds a complete copy of the consolidated data, followed by its FNV1a_64, the bank's generation and its write log
+#    define WEAR_LEVELING_BANK_SIZE ((WEAR_LEVELING_BACKING_SIZE) / 2)
+#    define WEAR_LEVELING_HEADER_SIZE 16
+#else
+// The consolidated data is followed by its FNV1a_64 and the write log
+#    define WEAR_LEVELING_BANK_SIZE (WEAR_LEVELING_BACKING_SIZE)
+#    define WEAR_LEVELING_HEADER_SIZE 8
+#endif // WEAR_LEVELING_DUAL_BANK
+
+// Offset of the first write log entry within a bank
+#define WEAR_LEVELING_LOG_OFFSET ((WEAR_LEVELING_LOGICAL_SIZE) + (WEAR_LEVELING_HEADER_SIZE))
+
+#ifdef WEAR_LEVELING_DUAL_BANK
+// Amount of logical data copied into the idle bank per call to wear_leveling_task()
+#    ifndef WEAR_LEVELING_CONSOLIDATION_STEP_SIZE
+#        define WEAR_LEVELING_CONSOLIDATION_STEP_SIZE ((BACKING_STORE_WRITE_SIZE) * 8)
+#    endif
+// Amount of the idle bank erased per call to wear_leveling_task(), a multiple of the backing store's erase unit
+#    ifndef WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE
+#        ifdef BACKING_STORE_ERASE_SIZE
+#            define WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE (BACKING_STORE_ERASE_SIZE)
+#        else
+#            define WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE (WEAR_LEVELING_BANK_SIZE)
+#        endif
+#    endif
+// Number of bytes of write log in use after which a background consolidation is started
+#    ifndef WEAR_LEVELING_CONSOLIDATION_THRESHOLD
+#        define WEAR_LEVELING_CONSOLIDATION_THRESHOLD (((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_OFFSET)) / 2)
+#    endif
+
+_Static_assert(WEAR_LEVELING_BANK_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Each bank must be at least twice the size of the logical size");
+_Static_assert(WEAR_LEVELING_BANK_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Bank size must be a multiple of logical size");
+_Static_assert(WEAR_LEVELING_CONSOLIDATION_STEP_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Consolidation step size must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_BANK_SIZE % WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE == 0, "Bank size must be a multiple of the consolidation erase size");
+#    ifdef BACKING_STORE_ERASE_SIZE
+_Static_assert(WEAR_LEVELING_CONSOLIDATION_ERASE_SIZE % BACKING_STORE_ERASE_SIZE == 0, "Consolidation erase size must be a multiple of the backing store's erase size");
+#    endif
+_Static_assert(WEAR_LEVELING_CONSOLIDATION_THRESHOLD < (WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_OFFSET), "Consolidation threshold must be smaller than the write log");
+#endif // WEAR_LEVELING_DUAL_BANK
+
+#ifdef WEAR_LEVELING_WRITE_COMBINING
+// Maximum number of separate dirty ranges held back before they get merged
+#    ifndef WEAR_LEVELING_WRITE_COMBINING_RANGES
+#        define WEAR_LEVELING_WRITE_COMBINING_RANGES 8
+#    endif
+// Number of milliseconds without writes after which dirty ranges are written to the log by wear_leveling_task()
+#    ifndef WEAR_LEVELING_WRITE_COMBINING_DELAY
+#        define WEAR_LEVELING_WRITE_COMBINING_DELAY 500
+#    endif
+
+_Static_assert(WEAR_LEVELING_WRITE_COMBINING_RANGES >= 1 && WEAR_LEVELING_WRITE_COMBINING_RANGES <= 255, "Write combining range count must be between 1 and 255");
+#endif // WEAR_LEVELING_WRITE_COMBINING
+
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
 bool backing_store_erase(void);
+bool backing_store_erase_range(uint32_t address, size_t length); // only required with WEAR_LEVELING_DUAL_BANK, erases at least the given range
 bool backing_store_write(uint32_t address, backing_store_int_t value);
 bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
 bool backing_store_lock(void);
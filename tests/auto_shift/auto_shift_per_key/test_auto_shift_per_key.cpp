@@ -0,0 +1,159 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Count how often the per-key callbacks run while typing. Eligibility of the
+// default Auto Shift groups and the timeout of a held key are looked up once,
+// so the counts below must not grow with hold duration or with the number of
+// custom keys.
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+#include "test_metrics.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+static unsigned timeout_calls = 0;
+static unsigned custom_calls  = 0;
+
+extern "C" {
+uint16_t get_autoshift_timeout(uint16_t keycode, keyrecord_t *record) {
+    timeout_calls++;
+    switch (keycode) {
+        case KC_B:
+            return 2 * get_generic_autoshift_timeout();
+        default:
+            return get_generic_autoshift_timeout();
+    }
+}
+
+bool get_custom_auto_shifted_key(uint16_t keycode, keyrecord_t *record) {
+    custom_calls++;
+    switch (keycode) {
+        case KC_ENTER:
+            return true;
+        default:
+            return false;
+    }
+}
+} // extern "C"
+
+class AutoShiftPerKey : public TestFixture {
+   public:
+    void SetUp() override {
+        timeout_calls = 0;
+        custom_calls  = 0;
+    }
+};
+
+TEST_F(AutoShiftPerKey, TimeoutEvaluatedOncePerPress) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    key.press();
+    for (unsigned i = 0; i < AUTO_SHIFT_TIMEOUT - 1; i++) {
+        run_one_scan_loop();
+    }
+    key.release();
+    run_one_scan_loop();
+
+    TestMetrics("CALLS", "get_autoshift_timeout").add("per_press", timeout_calls).report();
+    EXPECT_EQ(timeout_calls, 1u);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(AutoShiftPerKey, LongerTimeoutForKey) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, KC_B);
+
+    set_keymap({key});
+
+    /* Held past the generic timeout, but not past the one for KC_B. */
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    idle_for(AUTO_SHIFT_TIMEOUT + 10);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    /* Held past the timeout for KC_B, shifted from the matrix scan. */
+    EXPECT_REPORT(driver, (KC_LSFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key.press();
+    idle_for(2 * AUTO_SHIFT_TIMEOUT + 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_NO_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(AutoShiftPerKey, DefaultKeysSkipCustomCallback) {
+    TestDriver driver;
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    for (uint16_t keycode = KC_A; keycode <= KC_SLASH; keycode++) {
+        if (keycode >= KC_ENTER && keycode <= KC_SPACE && keycode != KC_TAB) {
+            continue;
+        }
+        auto key = KeymapKey(0, 0, 0, keycode);
+        set_keymap({key});
+        tap_key(key);
+    }
+
+    TestMetrics("CALLS", "get_custom_auto_shifted_key").add("default_keys", custom_calls).report();
+    EXPECT_EQ(custom_calls, 0u);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(AutoShiftPerKey, CustomKey) {
+    TestDriver driver;
+    InSequence s;
+    auto       key = KeymapKey(0, 0, 0, KC_ENTER);
+
+    set_keymap({key});
+
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    idle_for(AUTO_SHIFT_TIMEOUT);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_ENTER));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    /* Once on press and once on release. */
+    EXPECT_EQ(custom_calls, 2u);
+}
@@ -68,3 +68,20 @@ TEST_F(AutoShift, key_release_after_timeout) {
     run_one_scan_loop();
     testing::Mock::VerifyAndClearExpectations(&driver);
 }
+
+static bool is_in_auto_shift_group(uint16_t keycode) {
+    switch (keycode) {
+        case AUTO_SHIFT_ALPHA:
+        case AUTO_SHIFT_NUMERIC:
+        case AUTO_SHIFT_SPECIAL:
+            return true;
+    }
+    return false;
+}
+
+TEST_F(AutoShift, default_keys_match_groups) {
+    keyrecord_t record = {};
+    for (uint16_t keycode = 0; keycode <= UINT8_MAX; keycode++) {
+        EXPECT_EQ(get_auto_shifted_key(keycode, &record), is_in_auto_shift_group(keycode)) << "keycode " << keycode;
+    }
+}
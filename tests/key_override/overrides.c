@@ -0,0 +1,48 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "overrides.h"
+
+// clang-format off
+
+static const key_override_t shift_2_4       = ko_make_basic(MOD_MASK_SHIFT, KC_2, KC_4);
+static const key_override_t shift_1_2       = ko_make_basic(MOD_MASK_SHIFT, KC_1, KC_2);
+static const key_override_t shift_1_3       = ko_make_basic(MOD_MASK_SHIFT, KC_1, KC_3);
+static const key_override_t ctrl_1_5        = ko_make_basic(MOD_MASK_CTRL, KC_1, KC_5);
+static const key_override_t layer_1_shift_1 = ko_make_with_layers(MOD_MASK_SHIFT, KC_1, KC_6, 1 << 1);
+static const key_override_t shift_bspc_del  = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+
+// Fits in the index
+const key_override_t *shift_overrides[] = {
+    &layer_1_shift_1,
+    &shift_2_4,
+    &shift_1_2,
+    &shift_1_3,
+    NULL
+};
+
+// Longer than the index, checked one by one
+const key_override_t *long_overrides[] = {
+    &layer_1_shift_1,
+    &shift_2_4,
+    &ctrl_1_5,
+    &shift_bspc_del,
+    &shift_1_2,
+    &shift_1_3,
+    NULL
+};
+
+// clang-format on
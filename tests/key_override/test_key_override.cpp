@@ -0,0 +1,228 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+#include "overrides.h"
+
+using testing::_;
+using testing::InSequence;
+
+class KeyOverride : public TestFixture {
+   public:
+    void TearDown() override {
+        key_overrides = NULL;
+        TestFixture::TearDown();
+    }
+};
+
+// Overrides with the same trigger are tried in the order they are listed in.
+TEST_F(KeyOverride, FirstListedOverrideWins) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_shift = KeymapKey{0, 0, 0, KC_LSFT};
+    auto       key_1     = KeymapKey{0, 1, 0, KC_1};
+
+    set_keymap({key_shift, key_1});
+    key_overrides = shift_overrides;
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_2));
+    key_1.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_1.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(KeyOverride, OtherKeysAreNotOverridden) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_shift = KeymapKey{0, 0, 0, KC_LSFT};
+    auto       key_3     = KeymapKey{0, 1, 0, KC_3};
+
+    set_keymap({key_shift, key_3});
+    key_overrides = shift_overrides;
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_3));
+    key_3.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_3.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(KeyOverride, NoModsNoOverride) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_1 = KeymapKey{0, 1, 0, KC_1};
+
+    set_keymap({key_1});
+    key_overrides = shift_overrides;
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// Overrides limited to other layers are skipped.
+TEST_F(KeyOverride, LayerOverride) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_shift = KeymapKey{0, 0, 0, KC_LSFT};
+    auto       key_mo    = KeymapKey{0, 2, 0, MO(1)};
+    auto       key_1     = KeymapKey{1, 1, 0, KC_1};
+
+    set_keymap({key_shift, key_mo, key_1, KeymapKey{0, 1, 0, KC_1}});
+    key_overrides = shift_overrides;
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_NO_REPORT(driver);
+    key_mo.press();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_REPORT(driver, (KC_6));
+    key_1.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_1.release();
+    run_one_scan_loop();
+
+    EXPECT_NO_REPORT(driver);
+    key_mo.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// Lists longer than the index behave the same, and the index is rebuilt when the list changes.
+TEST_F(KeyOverride, LongListWithoutIndex) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_shift = KeymapKey{0, 0, 0, KC_LSFT};
+    auto       key_1     = KeymapKey{0, 1, 0, KC_1};
+    auto       key_bspc  = KeymapKey{0, 2, 0, KC_BSPC};
+
+    set_keymap({key_shift, key_1, key_bspc});
+
+    for (auto list : {shift_overrides, long_overrides}) {
+        key_overrides = list;
+
+        EXPECT_REPORT(driver, (KC_LSFT));
+        key_shift.press();
+        run_one_scan_loop();
+
+        EXPECT_REPORT(driver, (KC_2));
+        key_1.press();
+        run_one_scan_loop();
+
+        EXPECT_REPORT(driver, (KC_LSFT));
+        key_1.release();
+        run_one_scan_loop();
+
+        EXPECT_EMPTY_REPORT(driver);
+        key_shift.release();
+        run_one_scan_loop();
+        testing::Mock::VerifyAndClearExpectations(&driver);
+    }
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    key_bspc.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_bspc.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// Only overrides triggered by one of the held modifiers activate.
+TEST_F(KeyOverride, OtherModifiersDoNotTrigger) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_ctrl = KeymapKey{0, 0, 0, KC_LCTL};
+    auto       key_1    = KeymapKey{0, 1, 0, KC_1};
+
+    set_keymap({key_ctrl, key_1});
+    key_overrides = shift_overrides;
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_ctrl.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_1));
+    key_1.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_1.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    key_overrides = long_overrides;
+
+    EXPECT_REPORT(driver, (KC_5));
+    key_1.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_1.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_ctrl.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,27 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "test_common.hpp"
+#include "reference_action.h"
+
+class KeycodeActions : public TestFixture {};
+
+// The lookup tables resolve every keycode to the same action as the switch they replaced.
+TEST_F(KeycodeActions, TablesMatchSwitch) {
+    for (uint32_t keycode = 0; keycode <= UINT16_MAX; keycode++) {
+        EXPECT_EQ(action_for_keycode(keycode).code, reference_action_for_keycode(keycode).code) << "keycode 0x" << std::hex << keycode;
+    }
+}
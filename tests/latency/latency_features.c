@@ -0,0 +1,42 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "quantum.h"
+#include "latency_features.h"
+
+// Feature definitions for the latency tests, these can't be written in C++.
+
+// clang-format off
+enum combo_events { F3_F4_COMBO, COMBO_LENGTH };
+uint16_t COMBO_LEN = COMBO_LENGTH;
+
+const uint16_t f3_f4_combo[] PROGMEM = {KC_F3, KC_F4, COMBO_END};
+
+combo_t key_combos[] = {
+    [F3_F4_COMBO] = COMBO(f3_f4_combo, KC_ESC),
+};
+
+const key_override_t delete_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+
+const key_override_t **key_overrides = (const key_override_t *[]){
+    &delete_key_override,
+    NULL
+};
+
+qk_tap_dance_action_t tap_dance_actions[] = {
+    [TD_F5_F6] = ACTION_TAP_DANCE_DOUBLE(KC_F5, KC_F6),
+};
+// clang-format on
@@ -0,0 +1,295 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Measure the virtual time between a matrix transition and the first keyboard
+// report it causes, for plain keys and the features that intentionally delay
+// reports. The bounds below are the latencies the features are designed to
+// have, anything above them is a regression in time-to-report.
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+#include "test_latency.hpp"
+#include "latency_features.h"
+
+using testing::_;
+using testing::InvokeWithoutArgs;
+
+class ReportLatency : public TestFixture {
+   protected:
+    /* Every keyboard report stops the recorder, only the first one after
+     * `start()` is counted. */
+    void record_reports(TestDriver& driver, LatencyRecorder& recorder) {
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(InvokeWithoutArgs([&recorder]() { recorder.stop(); }));
+    }
+
+    /* Runs keyboard_task() until a report has been seen, or fails after
+     * `timeout_ms` of virtual time. */
+    void run_until_report(LatencyRecorder& recorder, unsigned timeout_ms = 1000) {
+        for (unsigned i = 0; i < timeout_ms && recorder.pending(); i++) {
+            run_one_scan_loop();
+        }
+        EXPECT_FALSE(recorder.pending()) << recorder.name() << ": no report within " << timeout_ms << "ms";
+        recorder.cancel();
+    }
+
+    /* Lets every feature time out before the next sample is taken. */
+    void settle() {
+        idle_for(TAPPING_TERM * 2);
+    }
+};
+
+TEST_F(ReportLatency, PlainKey) {
+    TestDriver      driver;
+    LatencyRecorder recorder("plain_key");
+    auto            key = KeymapKey(0, 0, 0, KC_F1);
+
+    set_keymap({key});
+    record_reports(driver, recorder);
+
+    for (unsigned hold = 1; hold <= 50; hold++) {
+        key.press();
+        recorder.start();
+        run_until_report(recorder);
+        idle_for(hold);
+        key.release();
+        settle();
+    }
+
+    recorder.report();
+    EXPECT_EQ(recorder.stats().max, 0u);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ReportLatency, ModTapTap) {
+    TestDriver      driver;
+    LatencyRecorder recorder("mod_tap_tap");
+    auto            key = KeymapKey(0, 0, 0, LCTL_T(KC_F2));
+
+    set_keymap({key});
+    record_reports(driver, recorder);
+
+    /* The tap is only known once the key is released, so the report can't
+     * come earlier than the hold duration. */
+    for (unsigned hold = 1; hold < TAPPING_TERM; hold += 5) {
+        key.press();
+        recorder.start();
+        idle_for(hold);
+        key.release();
+        run_until_report(recorder);
+        EXPECT_EQ(recorder.samples().back(), hold);
+        settle();
+    }
+
+    recorder.report();
+    EXPECT_LT(recorder.stats().max, (uint32_t)TAPPING_TERM);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ReportLatency, ModTapHold) {
+    TestDriver      driver;
+    LatencyRecorder recorder("mod_tap_hold");
+    auto            key = KeymapKey(0, 0, 0, LCTL_T(KC_F2));
+
+    set_keymap({key});
+    record_reports(driver, recorder);
+
+    for (unsigned i = 0; i < 20; i++) {
+        key.press();
+        recorder.start();
+        run_until_report(recorder);
+        key.release();
+        settle();
+    }
+
+    recorder.report();
+    EXPECT_LE(recorder.stats().max, (uint32_t)TAPPING_TERM);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ReportLatency, Combo) {
+    TestDriver      driver;
+    LatencyRecorder recorder("combo");
+    auto            key_f3 = KeymapKey(0, 0, 0, KC_F3);
+    auto            key_f4 = KeymapKey(0, 1, 0, KC_F4);
+
+    set_keymap({key_f3, key_f4});
+    record_reports(driver, recorder);
+
+    /* A complete chord is buffered for another combo term, in case a longer
+     * combo is still being pressed. */
+    for (unsigned gap = 0; gap < COMBO_TERM - 1; gap += 2) {
+        key_f3.press();
+        recorder.start();
+        run_one_scan_loop();
+        idle_for(gap);
+        key_f4.press();
+        run_until_report(recorder);
+        EXPECT_LE(recorder.samples().back(), gap + COMBO_TERM + 2);
+        key_f3.release();
+        key_f4.release();
+        settle();
+    }
+
+    recorder.report();
+    EXPECT_LE(recorder.stats().max, (uint32_t)COMBO_TERM * 2 + 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ReportLatency, ComboKeyAlone) {
+    TestDriver      driver;
+    LatencyRecorder recorder("combo_key_alone");
+    auto            key_f3 = KeymapKey(0, 0, 0, KC_F3);
+    auto            key_f4 = KeymapKey(0, 1, 0, KC_F4);
+
+    set_keymap({key_f3, key_f4});
+    record_reports(driver, recorder);
+
+    /* A lone combo key is held back until the combo term expires. */
+    for (unsigned i = 0; i < 20; i++) {
+        key_f3.press();
+        recorder.start();
+        run_until_report(recorder);
+        key_f3.release();
+        settle();
+    }
+
+    recorder.report();
+    EXPECT_LE(recorder.stats().max, (uint32_t)COMBO_TERM + 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ReportLatency, AutoShiftTap) {
+    TestDriver      driver;
+    LatencyRecorder recorder("auto_shift_tap");
+    auto            key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    record_reports(driver, recorder);
+
+    for (unsigned hold = 1; hold < AUTO_SHIFT_TIMEOUT; hold += 5) {
+        key.press();
+        recorder.start();
+        idle_for(hold);
+        key.release();
+        run_until_report(recorder);
+        EXPECT_LE(recorder.samples().back(), hold);
+        settle();
+    }
+
+    recorder.report();
+    EXPECT_LT(recorder.stats().max, (uint32_t)AUTO_SHIFT_TIMEOUT);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ReportLatency, AutoShiftHold) {
+    TestDriver      driver;
+    LatencyRecorder recorder("auto_shift_hold");
+    auto            key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    record_reports(driver, recorder);
+
+    for (unsigned extra = 0; extra < 50; extra += 5) {
+        key.press();
+        recorder.start();
+        idle_for(AUTO_SHIFT_TIMEOUT + extra);
+        key.release();
+        run_until_report(recorder);
+        settle();
+    }
+
+    recorder.report();
+    EXPECT_LE(recorder.stats().max, (uint32_t)AUTO_SHIFT_TIMEOUT);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ReportLatency, KeyOverride) {
+    TestDriver      driver;
+    LatencyRecorder recorder("key_override");
+    auto            key_shift = KeymapKey(0, 0, 0, KC_LSFT);
+    auto            key_bspc  = KeymapKey(0, 1, 0, KC_BSPC);
+
+    set_keymap({key_shift, key_bspc});
+    record_reports(driver, recorder);
+
+    for (unsigned i = 0; i < 20; i++) {
+        key_shift.press();
+        idle_for(i + 1);
+        key_bspc.press();
+        recorder.start();
+        run_until_report(recorder);
+        key_bspc.release();
+        key_shift.release();
+        settle();
+    }
+
+    recorder.report();
+    EXPECT_EQ(recorder.stats().max, 0u);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ReportLatency, TapDanceSingleTap) {
+    TestDriver      driver;
+    LatencyRecorder recorder("tap_dance_single_tap");
+    auto            key = KeymapKey(0, 0, 0, TD(TD_F5_F6));
+
+    set_keymap({key});
+    record_reports(driver, recorder);
+
+    /* A single tap can only be resolved once the tapping term since the
+     * press has passed without another tap. */
+    for (unsigned hold = 1; hold < TAPPING_TERM; hold += 10) {
+        key.press();
+        recorder.start();
+        idle_for(hold);
+        key.release();
+        run_until_report(recorder);
+        settle();
+    }
+
+    recorder.report();
+    EXPECT_LE(recorder.stats().max, (uint32_t)TAPPING_TERM + 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(ReportLatency, TapDanceInterrupted) {
+    TestDriver      driver;
+    LatencyRecorder recorder("tap_dance_interrupted");
+    auto            key       = KeymapKey(0, 0, 0, TD(TD_F5_F6));
+    auto            key_plain = KeymapKey(0, 1, 0, KC_F1);
+
+    set_keymap({key, key_plain});
+    record_reports(driver, recorder);
+
+    /* Pressing another key finishes the dance immediately. */
+    for (unsigned gap = 1; gap < TAPPING_TERM; gap += 10) {
+        tap_key(key);
+        idle_for(gap);
+        key_plain.press();
+        recorder.start();
+        run_until_report(recorder);
+        key_plain.release();
+        settle();
+    }
+
+    recorder.report();
+    EXPECT_EQ(recorder.stats().max, 0u);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,67 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "quantum.h"
+#include "leader_sequences.h"
+
+// Leader sequence table for the leader tests, it can't be written in C++.
+
+enum leader_results leader_result = LEADER_NONE;
+unsigned            leader_fired  = 0;
+
+static void fired(enum leader_results result) {
+    leader_result = result;
+    leader_fired++;
+}
+
+static void leader_f(void) {
+    fired(LEADER_F);
+}
+
+static void leader_dd(void) {
+    fired(LEADER_DD);
+}
+
+static void leader_dds(void) {
+    fired(LEADER_DDS);
+}
+
+static void leader_as(void) {
+    fired(LEADER_AS);
+}
+
+static void leader_x_first(void) {
+    fired(LEADER_X_FIRST);
+}
+
+static void leader_x_second(void) {
+    fired(LEADER_X_SECOND);
+}
+
+// Deliberately not sorted, the longer sequence comes before its prefix
+// clang-format off
+static const leader_sequence_t leader_table[] PROGMEM = {
+    LEADER_SEQUENCE(leader_dds, KC_D, KC_D, KC_S),
+    LEADER_SEQUENCE(leader_x_first, KC_X),
+    LEADER_SEQUENCE(leader_f, KC_F),
+    LEADER_SEQUENCE(leader_as, KC_A, KC_S),
+    LEADER_SEQUENCE(leader_dd, KC_D, KC_D),
+    LEADER_SEQUENCE(leader_x_second, KC_X),
+    LEADER_SEQUENCES_END
+};
+// clang-format on
+
+const leader_sequence_t *leader_sequences = leader_table;
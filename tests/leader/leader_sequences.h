@@ -0,0 +1,39 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum leader_results {
+    LEADER_NONE,
+    LEADER_F,
+    LEADER_DD,
+    LEADER_DDS,
+    LEADER_AS,
+    LEADER_X_FIRST,
+    LEADER_X_SECOND,
+};
+
+/* The sequence that fired last, and how many have fired. */
+extern enum leader_results leader_result;
+extern unsigned            leader_fired;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,143 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+#include "leader_sequences.h"
+
+using testing::_;
+
+extern "C" {
+LEADER_EXTERNS();
+}
+
+class LeaderSequences : public TestFixture {
+   protected:
+    KeymapKey key_lead = KeymapKey(0, 0, 0, KC_LEAD);
+    KeymapKey key_a    = KeymapKey(0, 1, 0, KC_A);
+    KeymapKey key_d    = KeymapKey(0, 2, 0, KC_D);
+    KeymapKey key_f    = KeymapKey(0, 3, 0, KC_F);
+    KeymapKey key_q    = KeymapKey(0, 4, 0, KC_Q);
+    KeymapKey key_s    = KeymapKey(0, 5, 0, KC_S);
+    KeymapKey key_x    = KeymapKey(0, 6, 0, KC_X);
+
+    void SetUp() override {
+        set_keymap({key_lead, key_a, key_d, key_f, key_q, key_s, key_x});
+        leader_result = LEADER_NONE;
+        leader_fired  = 0;
+    }
+};
+
+TEST_F(LeaderSequences, UniqueSequenceFiresImmediately) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_lead);
+    tap_key(key_f);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(leader_result, LEADER_F);
+    EXPECT_EQ(leader_fired, 1u);
+    EXPECT_FALSE(leading);
+
+    /* The timeout doesn't fire it again. */
+    idle_for(LEADER_TIMEOUT * 2);
+    EXPECT_EQ(leader_fired, 1u);
+}
+
+TEST_F(LeaderSequences, LongerSequenceFiresImmediately) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_lead);
+    tap_key(key_d);
+    tap_key(key_d);
+    EXPECT_EQ(leader_fired, 0u);
+    tap_key(key_s);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(leader_result, LEADER_DDS);
+    EXPECT_EQ(leader_fired, 1u);
+    EXPECT_FALSE(leading);
+}
+
+TEST_F(LeaderSequences, PrefixFiresOnTimeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_lead);
+    tap_key(key_d);
+    tap_key(key_d);
+
+    /* D, D could still become D, D, S. */
+    idle_for(LEADER_TIMEOUT / 2);
+    EXPECT_EQ(leader_fired, 0u);
+    EXPECT_TRUE(leading);
+
+    idle_for(LEADER_TIMEOUT);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(leader_result, LEADER_DD);
+    EXPECT_EQ(leader_fired, 1u);
+    EXPECT_FALSE(leading);
+}
+
+TEST_F(LeaderSequences, NoMatchEndsEarly) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_lead);
+    tap_key(key_q);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(leader_fired, 0u);
+    EXPECT_FALSE(leading);
+
+    /* Keys are sent as usual right away, without waiting for the timeout. */
+    EXPECT_REPORT(driver, (KC_Q));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_q);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(LeaderSequences, IncompleteSequenceTimesOut) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_lead);
+    tap_key(key_a);
+    idle_for(LEADER_TIMEOUT * 2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(leader_fired, 0u);
+    EXPECT_FALSE(leading);
+}
+
+TEST_F(LeaderSequences, FirstListedSequenceWins) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_lead);
+    tap_key(key_x);
+    idle_for(LEADER_TIMEOUT * 2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(leader_result, LEADER_X_FIRST);
+    EXPECT_EQ(leader_fired, 1u);
+}
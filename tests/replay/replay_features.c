@@ -0,0 +1,98 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "quantum.h"
+#include "replay_features.h"
+
+// Feature definitions for the replay tests, these can't be written in C++.
+// They are meant to be a heavy but plausible keymap, the traces exercise all
+// of them while typing.
+
+// clang-format off
+enum combo_events { ESC_COMBO, TAB_COMBO, BSPC_COMBO, ENT_COMBO, COMBO_LENGTH };
+uint16_t COMBO_LEN = COMBO_LENGTH;
+
+const uint16_t esc_combo[] PROGMEM  = {KC_W, KC_E, COMBO_END};
+const uint16_t tab_combo[] PROGMEM  = {KC_E, KC_R, COMBO_END};
+const uint16_t bspc_combo[] PROGMEM = {KC_U, KC_I, COMBO_END};
+const uint16_t ent_combo[] PROGMEM  = {KC_M, KC_COMM, COMBO_END};
+
+combo_t key_combos[] = {
+    [ESC_COMBO]  = COMBO(esc_combo, KC_ESC),
+    [TAB_COMBO]  = COMBO(tab_combo, KC_TAB),
+    [BSPC_COMBO] = COMBO(bspc_combo, KC_BSPC),
+    [ENT_COMBO]  = COMBO(ent_combo, KC_ENT),
+};
+
+const key_override_t delete_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t tilde_key_override  = ko_make_basic(MOD_MASK_SHIFT, KC_ESC, KC_TILD);
+const key_override_t ctrl_h_key_override = ko_make_basic(MOD_MASK_CTRL, KC_H, KC_BSPC);
+
+const key_override_t **key_overrides = (const key_override_t *[]){
+    &delete_key_override,
+    &tilde_key_override,
+    &ctrl_h_key_override,
+    NULL
+};
+
+qk_tap_dance_action_t tap_dance_actions[] = {
+    [TD_SLSH_BSLS] = ACTION_TAP_DANCE_DOUBLE(KC_SLSH, KC_BSLS),
+};
+// clang-format on
+
+LEADER_EXTERNS();
+
+unsigned leader_matches = 0;
+
+void matrix_scan_user(void) {
+    LEADER_DICTIONARY() {
+        leading = false;
+        leader_end();
+
+        SEQ_ONE_KEY(KC_F) {
+            leader_matches++;
+            tap_code16(C(KC_F));
+        }
+        SEQ_ONE_KEY(KC_S) {
+            leader_matches++;
+            tap_code16(C(KC_S));
+        }
+        SEQ_TWO_KEYS(KC_G, KC_S) {
+            leader_matches++;
+            SEND_STRING("git status\n");
+        }
+        SEQ_TWO_KEYS(KC_G, KC_C) {
+            leader_matches++;
+            SEND_STRING("git commit\n");
+        }
+        SEQ_TWO_KEYS(KC_G, KC_P) {
+            leader_matches++;
+            SEND_STRING("git push\n");
+        }
+        SEQ_THREE_KEYS(KC_D, KC_D, KC_S) {
+            leader_matches++;
+            SEND_STRING("qmk compile");
+        }
+        SEQ_THREE_KEYS(KC_D, KC_D, KC_T) {
+            leader_matches++;
+            SEND_STRING("make test:all");
+        }
+        SEQ_FOUR_KEYS(KC_E, KC_M, KC_A, KC_I) {
+            leader_matches++;
+            SEND_STRING("someone@example.com");
+        }
+    }
+}
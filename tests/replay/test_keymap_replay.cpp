@@ -0,0 +1,103 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Replay typing traces through a keymap with most of the keystroke processing
+// features enabled and report the CPU cost per matrix event, see "Replay
+// Tests" in docs/unit_testing.md. The numbers are written to
+// REPLAY_RESULTS_FILE so they can be compared across revisions, only the
+// behaviour is checked here.
+
+#include <fstream>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+#include "test_replay.hpp"
+#include "replay_features.h"
+
+static auto* const replay_results = ::testing::AddGlobalTestEnvironment(new ReplayResults(REPLAY_RESULTS_FILE));
+
+class KeymapReplay : public TestFixture {
+   protected:
+    void SetUp() override {
+        // clang-format off
+        static const uint16_t layers[2][MATRIX_ROWS][MATRIX_COLS] = {
+            {
+                {KC_Q,         KC_W,         KC_E,         KC_R,         KC_T,             KC_Y,    KC_U,         KC_I,         KC_O,         KC_P},
+                {LGUI_T(KC_A), LALT_T(KC_S), LCTL_T(KC_D), LSFT_T(KC_F), KC_G,             KC_H,    RSFT_T(KC_J), RCTL_T(KC_K), LALT_T(KC_L), RGUI_T(KC_SCLN)},
+                {KC_Z,         KC_X,         KC_C,         KC_V,         KC_B,             KC_N,    KC_M,         KC_COMM,      KC_DOT,       TD(TD_SLSH_BSLS)},
+                {KC_LEAD,      CAPSWRD,      KC_TAB,       KC_BSPC,      LT(1, KC_SPC),    KC_ENT,  MO(1),        KC_QUOT,      KC_MINS,      KC_ESC}
+            },
+            {
+                {KC_1,         KC_2,         KC_3,         KC_4,         KC_5,             KC_6,    KC_7,         KC_8,         KC_9,         KC_0},
+                {KC_EXLM,      KC_AT,        KC_HASH,      KC_DLR,       KC_PERC,          KC_CIRC, KC_AMPR,      KC_ASTR,      KC_LPRN,      KC_RPRN},
+                {KC_GRV,       KC_LBRC,      KC_RBRC,      KC_LCBR,      KC_RCBR,          KC_LEFT, KC_DOWN,      KC_UP,        KC_RGHT,      KC_EQL},
+                {KC_TRNS,      KC_TRNS,      KC_TRNS,      KC_TRNS,      KC_TRNS,          KC_TRNS, KC_TRNS,      KC_TRNS,      KC_TRNS,      KC_TRNS}
+            },
+        };
+        // clang-format on
+
+        for (uint8_t layer = 0; layer < 2; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    add_key(KeymapKey(layer, col, row, layers[layer][row][col]));
+                }
+            }
+        }
+        leader_matches = 0;
+    }
+
+    ReplayResult replay(const std::string& name) {
+        ReplayTrace trace;
+        EXPECT_TRUE(trace.load(std::string(REPLAY_TRACE_PATH "/") + name + ".txt")) << trace.error();
+
+        ReplayResult result = replay_trace(trace, 3);
+        ReplayResults::add(result);
+        return result;
+    }
+};
+
+TEST_F(KeymapReplay, Prose) {
+    ReplayResult result = replay("prose");
+
+    EXPECT_GT(result.events, 0u);
+    EXPECT_GT(result.reports, result.events / 2);
+}
+
+TEST_F(KeymapReplay, Code) {
+    ReplayResult result = replay("code");
+
+    EXPECT_GT(result.events, 0u);
+    EXPECT_GT(result.reports, result.events / 2);
+    /* The trace contains four leader sequences, and is replayed three times. */
+    EXPECT_EQ(leader_matches, 4u * 3);
+}
+
+// Traces are read with the simulator's parser, so repeat blocks and output commands work the same.
+TEST_F(KeymapReplay, SimulatorTraceSyntax) {
+    const std::string path = testing::TempDir() + "replay_syntax.txt";
+    ReplayTrace       trace;
+
+    std::ofstream(path) << "repeat 3\n  tap 0 0 20\n  repeat 2\n    wait 5\n  end\nend\nleds 0x02\nprint done\n";
+    ASSERT_TRUE(trace.load(path)) << trace.error();
+    EXPECT_EQ(trace.events(), 6u);
+    EXPECT_EQ(trace.steps().size(), 3u * (4 + 2));
+    EXPECT_EQ(trace.steps()[1].ms, 20u);
+
+    std::ofstream(path) << "repeat 2\n  tap 0 0\n";
+    EXPECT_FALSE(trace.load(path));
+    EXPECT_NE(trace.error().find("missing end"), std::string::npos) << trace.error();
+}
@@ -0,0 +1,123 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+using testing::Invoke;
+
+// The hex digits go through the send_string queue, while unicode input is
+// started and finished with direct key presses. Both have to reach the host
+// in order.
+class SendStringUnicode : public TestFixture {
+   public:
+    void TearDown() override {
+        send_string_flush();
+        TestFixture::TearDown();
+    }
+
+    /* Records the keys, without modifiers, in the order they are pressed */
+    void record_presses(TestDriver &driver) {
+        pressed.clear();
+        last = {};
+        EXPECT_ANY_REPORT(driver).Times(AnyNumber()).WillRepeatedly(Invoke([&](report_keyboard_t &report) {
+            for (uint8_t key : report.keys) {
+                if (key != KC_NO && !is_key_pressed(&last, key)) {
+                    pressed.push_back(key);
+                }
+            }
+            last = report;
+        }));
+    }
+
+    std::vector<uint8_t> pressed;
+    report_keyboard_t    last;
+};
+
+TEST_F(SendStringUnicode, LinuxDigitsBeforeFinish) {
+    TestDriver driver;
+    set_unicode_input_mode(UC_LNX);
+
+    record_presses(driver);
+    register_unicode(0x00E4);
+    EXPECT_FALSE(send_string_is_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(pressed, (std::vector<uint8_t>{KC_U, KC_0, KC_0, KC_E, KC_4, KC_SPACE}));
+}
+
+TEST_F(SendStringUnicode, LinuxAfterQueuedString) {
+    TestDriver driver;
+    set_unicode_input_mode(UC_LNX);
+
+    record_presses(driver);
+    send_string("ab");
+    register_unicode(0x00E4);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(pressed, (std::vector<uint8_t>{KC_A, KC_B, KC_U, KC_0, KC_0, KC_E, KC_4, KC_SPACE}));
+}
+
+TEST_F(SendStringUnicode, LinuxBatchedString) {
+    TestDriver driver;
+    set_unicode_input_mode(UC_LNX);
+
+    record_presses(driver);
+    send_unicode_string("\xC3\xA4\xC3\xAB");
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_EQ(pressed, (std::vector<uint8_t>{KC_U, KC_0, KC_0, KC_E, KC_4, KC_SPACE, KC_U, KC_0, KC_0, KC_E, KC_B, KC_SPACE}));
+}
+
+// The Unicode Hex Input key is held until every digit has been typed.
+TEST_F(SendStringUnicode, MacHoldsInputKeyOverDigits) {
+    TestDriver driver;
+    set_unicode_input_mode(UC_MAC);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LALT));
+        for (uint8_t digit : {KC_0, KC_0, KC_E, KC_4}) {
+            EXPECT_REPORT(driver, (KC_LALT, digit));
+            EXPECT_REPORT(driver, (KC_LALT));
+        }
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    register_unicode(0x00E4);
+    EXPECT_FALSE(send_string_is_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SendStringUnicode, MacBatchedString) {
+    TestDriver driver;
+    set_unicode_input_mode(UC_MAC);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LALT));
+        for (uint8_t digit : {KC_0, KC_0, KC_E, KC_4, KC_0, KC_0, KC_E, KC_B}) {
+            EXPECT_REPORT(driver, (KC_LALT, digit));
+            EXPECT_REPORT(driver, (KC_LALT));
+        }
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_unicode_string("\xC3\xA4\xC3\xAB");
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
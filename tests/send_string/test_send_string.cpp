@@ -0,0 +1,169 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class SendStringAsync : public TestFixture {
+   public:
+    void TearDown() override {
+        send_string_flush();
+        TestFixture::TearDown();
+    }
+};
+
+// Nothing is typed until the main loop runs, then one report per scan.
+TEST_F(SendStringAsync, TypesFromMainLoop) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    send_string("ab");
+    EXPECT_TRUE(send_string_is_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    EXPECT_FALSE(send_string_is_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SendStringAsync, ShiftedCharacter) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("A");
+    idle_for(10);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// Keys pressed while a string is waiting out a delay are held back until it has been typed.
+TEST_F(SendStringAsync, KeysPressedDuringDelay) {
+    TestDriver driver;
+    auto       key_b = KeymapKey(0, 0, 0, KC_B);
+
+    set_keymap({key_b});
+
+    send_string(SS_DELAY(100) "a");
+    idle_for(10);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    tap_key(key_b);
+    EXPECT_FALSE(send_string_is_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// Typing in the middle of a string doesn't split it up.
+TEST_F(SendStringAsync, KeysTypedDuringString) {
+    TestDriver driver;
+    auto       key_c = KeymapKey(0, 0, 0, KC_C);
+
+    set_keymap({key_c});
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_C));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_string("ab");
+    run_one_scan_loop();
+    tap_key(key_c);
+    EXPECT_FALSE(send_string_is_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// A modifier pressed during a string only applies to the keys after it.
+TEST_F(SendStringAsync, ModifierPressedDuringString) {
+    TestDriver driver;
+    auto       key_shift = KeymapKey(0, 0, 0, KC_LSFT);
+    auto       key_c     = KeymapKey(0, 1, 0, KC_C);
+
+    set_keymap({key_shift, key_c});
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_C));
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_string("Ab");
+    run_one_scan_loop();
+    key_shift.press();
+    run_one_scan_loop();
+    tap_key(key_c);
+    key_shift.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(send_string_is_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(SendStringAsync, FlushSendsEverything) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("ab");
+    send_string_flush();
+    EXPECT_FALSE(send_string_is_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// Strings longer than the queue are played back in part to make room, nothing is dropped.
+TEST_F(SendStringAsync, LongerThanQueue) {
+    TestDriver driver;
+
+    EXPECT_ANY_REPORT(driver).Times(2 * 40);
+    send_string("abcdefghijklmnopqrstuvwxyzabcdefghijklmn");
+    idle_for(2 * SEND_STRING_QUEUE_SIZE + 1);
+    EXPECT_FALSE(send_string_is_busy());
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,39 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "quantum.h"
+
+enum layers {
+    _BASE,
+    _NUM,
+};
+
+// clang-format off
+const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    [_BASE] = {
+        {KC_Q,         KC_W,    KC_E,    KC_R,    KC_T,             KC_Y,    KC_U,    KC_I,    KC_O,    KC_P},
+        {LSFT_T(KC_A), KC_S,    KC_D,    KC_F,    KC_G,             KC_H,    KC_J,    KC_K,    KC_L,    KC_ENT},
+        {KC_Z,         KC_X,    KC_C,    KC_V,    KC_B,             KC_N,    KC_M,    KC_COMM, KC_DOT,  CAPSWRD},
+        {KC_LCTL,      KC_LGUI, KC_LALT, KC_BSPC, LT(_NUM, KC_SPC), KC_VOLU, KC_VOLD, KC_MUTE, KC_CAPS, KC_ESC}
+    },
+    [_NUM] = {
+        {KC_1,         KC_2,    KC_3,    KC_4,    KC_5,             KC_6,    KC_7,    KC_8,    KC_9,    KC_0},
+        {_______,      _______, _______, _______, _______,          KC_LEFT, KC_DOWN, KC_UP,   KC_RGHT, _______},
+        {_______,      _______, _______, _______, _______,          _______, _______, _______, _______, _______},
+        {_______,      _______, _______, _______, _______,          _______, _______, _______, _______, _______}
+    },
+};
+// clang-format on
@@ -0,0 +1,37 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "quantum.h"
+#include "concurrent_dances.h"
+
+// clang-format off
+
+qk_tap_dance_action_t tap_dance_actions[] = {
+    [TD_AB] = ACTION_TAP_DANCE_DOUBLE(KC_A, KC_B),
+    [TD_CD] = ACTION_TAP_DANCE_DOUBLE(KC_C, KC_D),
+    [TD_EF] = ACTION_TAP_DANCE_DOUBLE(KC_E, KC_F),
+};
+
+// clang-format on
+
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    switch (keycode) {
+        case TD(TD_AB):
+            return TAPPING_TERM * 2;
+        default:
+            return TAPPING_TERM;
+    }
+}
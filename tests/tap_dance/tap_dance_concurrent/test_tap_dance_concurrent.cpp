@@ -0,0 +1,135 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_keymap_key.hpp"
+#include "concurrent_dances.h"
+
+using testing::_;
+using testing::InSequence;
+
+class TapDanceConcurrent : public TestFixture {};
+
+// Rolling over a second dance does not cut the first one short.
+TEST_F(TapDanceConcurrent, RollTwoDances) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_ab = KeymapKey{0, 0, 0, TD(TD_AB)};
+    auto       key_cd = KeymapKey{0, 1, 0, TD(TD_CD)};
+
+    set_keymap({key_ab, key_cd});
+
+    EXPECT_NO_REPORT(driver);
+    key_ab.press();
+    run_one_scan_loop();
+    key_cd.press();
+    run_one_scan_loop();
+    key_ab.release();
+    run_one_scan_loop();
+    key_cd.release();
+    run_one_scan_loop();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    /* A second tap of the first dance still counts */
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_ab);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(TAPPING_TERM + 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// The second dance times out first, but the first one is still finished ahead of it.
+TEST_F(TapDanceConcurrent, FinishInStartOrder) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_ab = KeymapKey{0, 0, 0, TD(TD_AB)};
+    auto       key_cd = KeymapKey{0, 1, 0, TD(TD_CD)};
+
+    set_keymap({key_ab, key_cd});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_ab);
+    tap_key(key_cd);
+    idle_for(TAPPING_TERM - 2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+TEST_F(TapDanceConcurrent, OtherKeyInterruptsAll) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_ab = KeymapKey{0, 0, 0, TD(TD_AB)};
+    auto       key_cd = KeymapKey{0, 1, 0, TD(TD_CD)};
+    auto       key_x  = KeymapKey{0, 2, 0, KC_X};
+
+    set_keymap({key_ab, key_cd, key_x});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_ab);
+    tap_key(key_cd);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_x);
+    idle_for(TAPPING_TERM * 2);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// With two dances in progress, a third one finishes the oldest.
+TEST_F(TapDanceConcurrent, TableFullFinishesOldest) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_ab = KeymapKey{0, 0, 0, TD(TD_AB)};
+    auto       key_cd = KeymapKey{0, 1, 0, TD(TD_CD)};
+    auto       key_ef = KeymapKey{0, 2, 0, TD(TD_EF)};
+
+    set_keymap({key_ab, key_cd, key_ef});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_ab);
+    tap_key(key_cd);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_ef);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(TAPPING_TERM + 1);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
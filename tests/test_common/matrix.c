@@ -36,9 +36,17 @@ matrix_row_t matrix_get_row(uint8_t row) {
 
 void matrix_print(void) {}
 
-void matrix_init_kb(void) {}
+__attribute__((weak)) void matrix_init_kb(void) {
+    matrix_init_user();
+}
+
+__attribute__((weak)) void matrix_scan_kb(void) {
+    matrix_scan_user();
+}
+
+__attribute__((weak)) void matrix_init_user(void) {}
 
-void matrix_scan_kb(void) {}
+__attribute__((weak)) void matrix_scan_user(void) {}
 
 void press_key(uint8_t col, uint8_t row) {
     matrix[row] |= 1 << col;
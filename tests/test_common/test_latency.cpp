@@ -0,0 +1,71 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "test_latency.hpp"
+#include <algorithm>
+#include <numeric>
+#include "test_logger.hpp"
+#include "test_metrics.hpp"
+
+extern "C" {
+#include "timer.h"
+}
+
+void LatencyRecorder::start() {
+    m_start   = timer_read32();
+    m_pending = true;
+}
+
+void LatencyRecorder::stop() {
+    if (!m_pending) {
+        return;
+    }
+    m_pending        = false;
+    uint32_t latency = TIMER_DIFF_32(timer_read32(), m_start);
+    test_logger.trace() << m_name << " latency: " << latency << "ms" << std::endl;
+    m_samples.push_back(latency);
+}
+
+LatencyStats LatencyRecorder::stats() const {
+    LatencyStats stats = {};
+    if (m_samples.empty()) {
+        return stats;
+    }
+
+    std::vector<uint32_t> sorted(m_samples);
+    std::sort(sorted.begin(), sorted.end());
+
+    stats.count  = sorted.size();
+    stats.min    = sorted.front();
+    stats.max    = sorted.back();
+    stats.median = sorted[sorted.size() / 2];
+    stats.p90    = sorted[(sorted.size() * 9) / 10];
+    stats.mean   = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    return stats;
+}
+
+void LatencyRecorder::report() const {
+    LatencyStats stats = this->stats();
+
+    TestMetrics("LATENCY", m_name)
+        .add("n", stats.count)
+        .add("min", stats.min, "ms")
+        .add("median", stats.median, "ms")
+        .add("p90", stats.p90, "ms")
+        .add("max", stats.max, "ms")
+        .add("mean", stats.mean, "ms")
+        .report();
+}
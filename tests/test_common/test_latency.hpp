@@ -0,0 +1,71 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct LatencyStats {
+    size_t   count;
+    uint32_t min;
+    uint32_t median;
+    uint32_t p90;
+    uint32_t max;
+    double   mean;
+};
+
+/**
+ * @brief Records keypress-to-report latencies against the virtual test clock.
+ *
+ * Call `start()` right after injecting the matrix transition that begins a
+ * gesture, and `stop()` from the keyboard report hook. Only the first report
+ * after each `start()` produces a sample, all timestamps are taken from
+ * `timer_read32()` so samples are measured in milliseconds of virtual time.
+ */
+class LatencyRecorder {
+   public:
+    LatencyRecorder(std::string name) : m_name(name) {}
+
+    void start();
+    void stop();
+    bool pending() const {
+        return m_pending;
+    }
+    void cancel() {
+        m_pending = false;
+    }
+
+    const std::string& name() const {
+        return m_name;
+    }
+    const std::vector<uint32_t>& samples() const {
+        return m_samples;
+    }
+    LatencyStats stats() const;
+
+    /**
+     * @brief Reports the distribution summary through TestMetrics.
+     */
+    void report() const;
+
+   private:
+    std::string           m_name;
+    std::vector<uint32_t> m_samples;
+    uint32_t              m_start   = 0;
+    bool                  m_pending = false;
+};
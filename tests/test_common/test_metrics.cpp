@@ -0,0 +1,37 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "test_metrics.hpp"
+#include <iomanip>
+#include <iostream>
+#include "gtest/gtest.h"
+
+static std::ostream& print_tag(const std::string& tag) {
+    return std::cout << "[ " << std::left << std::setw(9) << tag << std::right << "] ";
+}
+
+void TestMetrics::report() const {
+    std::ostream& stream = print_tag(m_tag) << m_name << ":";
+    for (const auto& value : m_values) {
+        stream << " " << value.key << "=" << value.value << value.unit;
+        ::testing::Test::RecordProperty(m_name + "_" + value.key, value.value);
+    }
+    stream << std::endl;
+}
+
+void test_metrics_note(const std::string& tag, const std::string& message) {
+    print_tag(tag) << message << std::endl;
+}
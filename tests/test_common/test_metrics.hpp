@@ -0,0 +1,61 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Collects the measurements of a single run for reporting.
+ *
+ * `report()` prints them as one line, tagged like gtest's own output, and
+ * records each one as a `<name>_<key>` property of the currently running
+ * test so it ends up in gtest's XML/JSON output as well.
+ */
+class TestMetrics {
+   public:
+    TestMetrics(std::string tag, std::string name) : m_tag(tag), m_name(name) {}
+
+    template <typename T>
+    TestMetrics& add(const std::string& key, const T& value, const std::string& unit = "") {
+        std::ostringstream stream;
+        stream.setf(std::ios::fixed, std::ios::floatfield);
+        stream.precision(2);
+        stream << value;
+        m_values.push_back({key, stream.str(), unit});
+        return *this;
+    }
+
+    void report() const;
+
+   private:
+    struct Value {
+        std::string key;
+        std::string value;
+        std::string unit;
+    };
+
+    std::string        m_tag;
+    std::string        m_name;
+    std::vector<Value> m_values;
+};
+
+/**
+ * @brief Prints a free-form message with the same tag layout as TestMetrics.
+ */
+void test_metrics_note(const std::string& tag, const std::string& message);
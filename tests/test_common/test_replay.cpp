@@ -0,0 +1,285 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "test_replay.hpp"
+#include "test_metrics.hpp"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+
+extern "C" {
+#include "host.h"
+#include "keyboard.h"
+#include "timer.h"
+#include "test_matrix.h"
+
+void advance_time(uint32_t ms);
+}
+
+bool ReplayTrace::load(const std::string& path) {
+    auto slash = path.find_last_of('/');
+    m_name     = path.substr(slash == std::string::npos ? 0 : slash + 1);
+    m_name     = m_name.substr(0, m_name.find_last_of('.'));
+    m_steps.clear();
+    m_events = 0;
+
+    // Parsed by the firmware simulator's parser, so both accept the same traces
+    sim_trace_t trace = {};
+    bool        ok    = sim_trace_load(&trace, path.c_str());
+    if (ok) {
+        append_steps(trace);
+    } else {
+        m_error = trace.error;
+    }
+    sim_trace_free(&trace);
+    return ok;
+}
+
+void ReplayTrace::append_steps(const sim_trace_t& trace) {
+    // Repeat blocks are unrolled, mirroring sim_trace_execute()
+    uint32_t remaining[SIM_TRACE_MAX_NESTING];
+    uint8_t  depth = 0;
+
+    for (uint32_t pc = 0; pc < trace.count; pc++) {
+        const sim_command_t& command = trace.commands[pc];
+        switch (command.kind) {
+            case SIM_PRESS:
+                m_steps.push_back({Step::Press, command.row, command.col, 0});
+                m_events++;
+                break;
+            case SIM_RELEASE:
+                m_steps.push_back({Step::Release, command.row, command.col, 0});
+                m_events++;
+                break;
+            case SIM_TAP:
+                m_steps.push_back({Step::Press, command.row, command.col, 0});
+                m_steps.push_back({Step::Wait, 0, 0, command.value});
+                m_steps.push_back({Step::Release, command.row, command.col, 0});
+                m_steps.push_back({Step::Wait, 0, 0, 1});
+                m_events += 2;
+                break;
+            case SIM_WAIT:
+                m_steps.push_back({Step::Wait, 0, 0, command.value});
+                break;
+            case SIM_REPEAT:
+                if (command.value == 0) {
+                    pc = command.match;
+                } else {
+                    remaining[depth++] = command.value;
+                }
+                break;
+            case SIM_END:
+                if (--remaining[depth - 1] > 0) {
+                    pc = command.match;
+                } else {
+                    depth--;
+                }
+                break;
+            case SIM_LEDS:
+            case SIM_DUMP:
+            case SIM_PRINT:
+                // Output of the simulator, nothing to replay
+                break;
+        }
+    }
+}
+
+CostCounter::CostCounter() {
+#if defined(__linux__)
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled       = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    m_fd                = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+}
+
+CostCounter::~CostCounter() {
+#if defined(__linux__)
+    if (m_fd >= 0) {
+        close(m_fd);
+    }
+#endif
+}
+
+const char* CostCounter::unit() const {
+    if (m_fd >= 0) {
+        return "instructions";
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    return "tsc_cycles";
+#else
+    return "ns";
+#endif
+}
+
+static uint64_t read_fallback_counter() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void CostCounter::start() {
+#if defined(__linux__)
+    if (m_fd >= 0) {
+        ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+        return;
+    }
+#endif
+    m_start = read_fallback_counter();
+}
+
+uint64_t CostCounter::stop() {
+#if defined(__linux__)
+    if (m_fd >= 0) {
+        uint64_t count = 0;
+        ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(m_fd, &count, sizeof(count)) != sizeof(count)) {
+            return 0;
+        }
+        return count;
+    }
+#endif
+    return read_fallback_counter() - m_start;
+}
+
+static uint32_t replay_reports = 0;
+
+static uint8_t replay_keyboard_leds(void) {
+    return 0;
+}
+
+static void replay_send_keyboard(report_keyboard_t* report) {
+    replay_reports++;
+}
+
+static void replay_send_mouse(report_mouse_t* report) {
+    replay_reports++;
+}
+
+static void replay_send_extra(uint16_t data) {
+    replay_reports++;
+}
+
+static void replay_send_programmable_button(uint32_t data) {
+    replay_reports++;
+}
+
+static host_driver_t replay_driver = {replay_keyboard_leds, replay_send_keyboard, replay_send_mouse, replay_send_extra, replay_send_extra, replay_send_programmable_button};
+
+ReplayResult replay_trace(const ReplayTrace& trace, unsigned runs, unsigned settle_ms) {
+    ReplayResult   result = {trace.name(), trace.events(), 0, 0, UINT64_MAX, ""};
+    CostCounter    counter;
+    host_driver_t* previous_driver = host_get_driver();
+
+    host_set_driver(&replay_driver);
+    for (unsigned run = 0; run < runs; run++) {
+        uint32_t scans = 0;
+        replay_reports = 0;
+
+        counter.start();
+        for (const auto& step : trace.steps()) {
+            switch (step.kind) {
+                case ReplayTrace::Step::Press:
+                    press_key(step.col, step.row);
+                    break;
+                case ReplayTrace::Step::Release:
+                    release_key(step.col, step.row);
+                    break;
+                case ReplayTrace::Step::Wait:
+                    for (uint32_t i = 0; i < step.ms; i++) {
+                        keyboard_task();
+                        advance_time(1);
+                    }
+                    scans += step.ms;
+                    break;
+            }
+        }
+        uint64_t cost = counter.stop();
+
+        clear_all_keys();
+        for (unsigned i = 0; i < settle_ms; i++) {
+            keyboard_task();
+            advance_time(1);
+        }
+
+        if (cost < result.cost) {
+            result.cost = cost;
+        }
+        result.scans   = scans;
+        result.reports = replay_reports;
+    }
+    host_set_driver(previous_driver);
+
+    result.unit = counter.unit();
+    return result;
+}
+
+static std::vector<ReplayResult> replay_results;
+
+void ReplayResults::add(const ReplayResult& result) {
+    TestMetrics("REPLAY", result.trace)
+        .add("events", result.events)
+        .add("scans", result.scans)
+        .add("reports", result.reports)
+        .add(result.unit + "_per_event", (uint64_t)result.cost_per_event())
+        .add(result.unit + "_per_scan", (uint64_t)result.cost_per_scan())
+        .report();
+
+    replay_results.push_back(result);
+}
+
+void ReplayResults::TearDown() {
+    std::ofstream file(m_path);
+    if (!file) {
+        std::cerr << m_path << ": can't write replay results" << std::endl;
+        return;
+    }
+
+    file << "{\n  \"results\": [";
+    for (size_t i = 0; i < replay_results.size(); i++) {
+        const auto& result = replay_results[i];
+        file << (i ? "," : "") << "\n    {";
+        file << "\"trace\": \"" << result.trace << "\", ";
+        file << "\"events\": " << result.events << ", ";
+        file << "\"scans\": " << result.scans << ", ";
+        file << "\"reports\": " << result.reports << ", ";
+        file << "\"unit\": \"" << result.unit << "\", ";
+        file << "\"cost\": " << result.cost << ", ";
+        file << "\"cost_per_event\": " << (uint64_t)result.cost_per_event() << ", ";
+        file << "\"cost_per_scan\": " << (uint64_t)result.cost_per_scan() << "}";
+    }
+    file << "\n  ]\n}\n";
+    test_metrics_note("REPLAY", "results written to " + m_path);
+}
@@ -0,0 +1,133 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "sim_trace.h"
+
+/**
+ * @brief A typing trace, parsed with the firmware simulator's trace parser.
+ *
+ * The matrix commands `press`, `release`, `tap` and `wait` are replayed,
+ * with `repeat` blocks unrolled. The simulator's output commands are
+ * accepted and ignored.
+ */
+class ReplayTrace {
+   public:
+    struct Step {
+        enum Kind { Press, Release, Wait } kind;
+        uint8_t  row;
+        uint8_t  col;
+        uint32_t ms;
+    };
+
+    /* Loads the trace at `path`, returns false and sets `error()` if it can't
+     * be read or contains an invalid command. */
+    bool load(const std::string& path);
+
+    const std::string& name() const {
+        return m_name;
+    }
+    const std::string& error() const {
+        return m_error;
+    }
+    const std::vector<Step>& steps() const {
+        return m_steps;
+    }
+    /* Number of matrix transitions in the trace. */
+    size_t events() const {
+        return m_events;
+    }
+
+   private:
+    void append_steps(const sim_trace_t& trace);
+
+    std::string       m_name;
+    std::string       m_error;
+    std::vector<Step> m_steps;
+    size_t            m_events = 0;
+};
+
+/**
+ * @brief Counts the CPU work done between `start()` and `stop()`.
+ *
+ * Uses the retired instruction counter from perf_event_open() on Linux when
+ * the kernel allows it, otherwise the time stamp counter on x86 and the
+ * monotonic clock everywhere else. `unit()` names what is being counted,
+ * only numbers with the same unit can be compared.
+ */
+class CostCounter {
+   public:
+    CostCounter();
+    ~CostCounter();
+
+    void     start();
+    uint64_t stop();
+
+    const char* unit() const;
+
+   private:
+    int      m_fd    = -1;
+    uint64_t m_start = 0;
+};
+
+struct ReplayResult {
+    std::string trace;
+    size_t      events;
+    uint32_t    scans;
+    uint32_t    reports;
+    uint64_t    cost;
+    std::string unit;
+
+    double cost_per_event() const {
+        return events ? (double)cost / events : 0;
+    }
+    double cost_per_scan() const {
+        return scans ? (double)cost / scans : 0;
+    }
+};
+
+/**
+ * @brief Replays a trace through keyboard_task() and measures its cost.
+ *
+ * The keyboard reports go to a counting host driver instead of the mocked
+ * one, so the cost of gmock's expectation matching isn't measured. The trace
+ * is replayed `runs` times and the cheapest run is kept, the state between
+ * runs is settled for `settle_ms` of unmeasured scans.
+ */
+ReplayResult replay_trace(const ReplayTrace& trace, unsigned runs = 3, unsigned settle_ms = 1000);
+
+/**
+ * @brief Collects replay results and writes them as JSON when the test
+ * program ends, register it with `testing::AddGlobalTestEnvironment()`.
+ *
+ * `add()` also prints the result and records it as properties of the
+ * currently running test, like LatencyRecorder::report() does.
+ */
+class ReplayResults : public ::testing::Environment {
+   public:
+    ReplayResults(std::string path) : m_path(path) {}
+
+    static void add(const ReplayResult& result);
+    void        TearDown() override;
+
+   private:
+    std::string m_path;
+};
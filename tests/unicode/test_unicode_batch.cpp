@@ -0,0 +1,117 @@
+/* Copyright 2022 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+using testing::Invoke;
+
+// "é→😀λ", one character from each of the two, three and four byte UTF-8 ranges
+static const char     batch_string[]      = "\xC3\xA9\xE2\x86\x92\xF0\x9F\x98\x80\xCE\xBB";
+static const uint32_t batch_code_points[] = {0x00E9, 0x2192, 0x1F600, 0x03BB};
+static const int      batch_length        = sizeof(batch_code_points) / sizeof(*batch_code_points);
+
+class UnicodeBatch : public TestFixture {
+   public:
+    int count_string_reports(TestDriver &driver, uint8_t mode) {
+        int reports = 0;
+        set_unicode_input_mode(mode);
+        EXPECT_ANY_REPORT(driver).Times(AnyNumber()).WillRepeatedly(Invoke([&](report_keyboard_t &) { reports++; }));
+        send_unicode_string(batch_string);
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return reports;
+    }
+
+    int count_code_point_reports(TestDriver &driver, uint8_t mode) {
+        int reports = 0;
+        set_unicode_input_mode(mode);
+        EXPECT_ANY_REPORT(driver).Times(AnyNumber()).WillRepeatedly(Invoke([&](report_keyboard_t &) { reports++; }));
+        for (int i = 0; i < batch_length; i++) {
+            register_unicode(batch_code_points[i]);
+        }
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return reports;
+    }
+};
+
+// The Unicode Hex Input key stays held for the whole string.
+TEST_F(UnicodeBatch, MacHoldsInputKey) {
+    TestDriver driver;
+    set_unicode_input_mode(UC_MAC);
+
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_LALT));
+        for (uint8_t digit : {KC_0, KC_0, KC_E, KC_9, KC_0, KC_0, KC_E, KC_B}) {
+            EXPECT_REPORT(driver, (KC_LALT, digit));
+            EXPECT_REPORT(driver, (KC_LALT));
+        }
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_unicode_string("\xC3\xA9\xC3\xAB");
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// Linux still needs each code point committed and the next one started, but
+// Caps Lock is only toggled around the whole string.
+TEST_F(UnicodeBatch, LinuxTogglesCapsLockOnce) {
+    TestDriver driver;
+    set_unicode_input_mode(UC_LNX);
+    driver.set_leds(1 << USB_LED_CAPS_LOCK);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_CAPS)).Times(2);
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT, KC_U)).Times(2);
+    send_unicode_string("\xC3\xA9\xC3\xAB");
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// U+1F600 cannot be typed with the Windows numpad method, so it does not start input.
+TEST_F(UnicodeBatch, OutOfRangeCodePointsAreSkipped) {
+    TestDriver driver;
+    set_unicode_input_mode(UC_WIN);
+
+    EXPECT_NO_REPORT(driver);
+    send_unicode_string("\xF0\x9F\x98\x80");
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
+
+// Batched strings never take more reports per code point than typing the
+// code points one at a time, and strictly fewer where the input method
+// can stay open.
+TEST_F(UnicodeBatch, ReportsPerCodePoint) {
+    TestDriver driver;
+
+    for (uint8_t mode : {UC_MAC, UC_LNX, UC_WIN, UC_WINC, UC_EMACS}) {
+        int batched   = count_string_reports(driver, mode);
+        int unbatched = count_code_point_reports(driver, mode);
+        EXPECT_LE(batched, unbatched) << "input mode " << (int)mode;
+    }
+
+    // Only the first code point pays for starting input, the last for finishing it
+    EXPECT_EQ(count_string_reports(driver, UC_MAC), (4 + 4 + 8 + 4) * 2 + 2);
+    EXPECT_EQ(count_code_point_reports(driver, UC_MAC), (4 + 4 + 8 + 4) * 2 + 2 * batch_length);
+
+    // Caps Lock and Num Lock are restored once per string rather than per code point
+    driver.set_leds(1 << USB_LED_CAPS_LOCK);
+    EXPECT_LT(count_string_reports(driver, UC_LNX), count_code_point_reports(driver, UC_LNX));
+    driver.set_leds(0);
+    EXPECT_LT(count_string_reports(driver, UC_WIN), count_code_point_reports(driver, UC_WIN));
+}
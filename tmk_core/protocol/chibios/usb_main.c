@@ -43,6 +43,7 @@
 #include "usb_device_state.h"
 #include "usb_descriptor.h"
 #include "usb_driver.h"
+#include "ring_buffer.h"
 
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
@@ -391,34 +392,23 @@ static usb_driver_configs_t drivers = {
  */
 
 #define USB_EVENT_QUEUE_SIZE 16
-usbevent_t event_queue[USB_EVENT_QUEUE_SIZE];
-uint8_t    event_queue_head;
-uint8_t    event_queue_tail;
+
+// Filled from the USB interrupt, drained by the main loop.
+RING_BUFFER_DECLARE(usb_event_ring, usbevent_t, USB_EVENT_QUEUE_SIZE);
+
+static usb_event_ring_t event_queue;
 
 void usb_event_queue_init(void) {
     // Initialise the event queue
-    memset(&event_queue, 0, sizeof(event_queue));
-    event_queue_head = 0;
-    event_queue_tail = 0;
+    usb_event_ring_init(&event_queue);
 }
 
 static inline bool usb_event_queue_enqueue(usbevent_t event) {
-    uint8_t next = (event_queue_head + 1) % USB_EVENT_QUEUE_SIZE;
-    if (next == event_queue_tail) {
-        return false;
-    }
-    event_queue[event_queue_head] = event;
-    event_queue_head              = next;
-    return true;
+    return usb_event_ring_push(&event_queue, event);
 }
 
 static inline bool usb_event_queue_dequeue(usbevent_t *event) {
-    if (event_queue_head == event_queue_tail) {
-        return false;
-    }
-    *event           = event_queue[event_queue_tail];
-    event_queue_tail = (event_queue_tail + 1) % USB_EVENT_QUEUE_SIZE;
-    return true;
+    return usb_event_ring_pop(&event_queue, event);
 }
 
 static inline void usb_event_suspend_handler(void) {
@@ -901,6 +891,13 @@ void mouse_in_cb(USBDriver *usbp, usbep_t ep) {
 }
 #    endif
 
+bool mouse_endpoint_ready(void) {
+    osalSysLock();
+    bool ready = usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE || !usbGetTransmitStatusI(&USB_DRIVER, MOUSE_IN_EPNUM);
+    osalSysUnlock();
+    return ready;
+}
+
 void send_mouse(report_mouse_t *report) {
     osalSysLock();
     if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
@@ -75,6 +75,9 @@ void nkro_in_cb(USBDriver *usbp, usbep_t ep);
 
 /* mouse IN request callback handler */
 void mouse_in_cb(USBDriver *usbp, usbep_t ep);
+
+/* false while the previous mouse report is still waiting to be collected by the host */
+bool mouse_endpoint_ready(void);
 #endif /* MOUSE_ENABLE */
 
 /* ---------------
@@ -31,20 +31,48 @@ static int8_t cb_tail  = 0;
 static int8_t cb_count = 0;
 #endif
 
+#ifdef NKRO_ENABLE
+#    ifdef KEYBOARD_REPORT_BITS_MAX
+_Static_assert(KEYBOARD_REPORT_BITS <= KEYBOARD_REPORT_BITS_MAX, "KEYBOARD_REPORT_BITS does not fit the NKRO endpoint");
+#    endif
+_Static_assert(KEYBOARD_REPORT_BITS * 8 <= UINT8_MAX, "has_anykey() count does not fit in a uint8_t");
+_Static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "NKRO word scan assumes little endian");
+
+// The NKRO bitmap is scanned a machine word at a time, 16 bits on AVR and 32
+// bits on ARM. It isn't aligned, so words are assembled with memcpy.
+typedef unsigned int nkro_word_t;
+#    define NKRO_WORD_SIZE sizeof(nkro_word_t)
+
+static inline nkro_word_t nkro_word_at(report_keyboard_t* keyboard_report, uint8_t index) {
+    nkro_word_t word = 0;
+    memcpy(&word, &keyboard_report->nkro.bits[index], MIN(NKRO_WORD_SIZE, (uint8_t)(KEYBOARD_REPORT_BITS - index)));
+    return word;
+}
+#endif
+
 /** \brief has_anykey
  *
- * FIXME: Needs doc
+ * Returns the number of keys in the report, zero if none are pressed.
+ *
+ * In NKRO mode the bitmap is counted a word at a time rather than keeping a
+ * running count. The report struct is the HID wire format, so a count can
+ * only live outside it, where it goes stale as soon as a caller fills a
+ * report with memcpy or works on more than one report. The scan is at most
+ * a few words, and only runs while one-shot mods are pending.
  */
 uint8_t has_anykey(report_keyboard_t* keyboard_report) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
-        p  = keyboard_report->nkro.bits;
-        lp = sizeof(keyboard_report->nkro.bits);
+        uint8_t cnt = 0;
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_BITS; i += NKRO_WORD_SIZE) {
+            cnt += __builtin_popcount(nkro_word_at(keyboard_report, i));
+        }
+        return cnt;
     }
 #endif
+    uint8_t  cnt = 0;
+    uint8_t* p   = keyboard_report->keys;
+    uint8_t  lp  = sizeof(keyboard_report->keys);
     while (lp--) {
         if (*p++) cnt++;
     }
@@ -53,15 +81,19 @@ uint8_t has_anykey(report_keyboard_t* keyboard_report) {
 
 /** \brief get_first_key
  *
- * FIXME: Needs doc
+ * Returns a key in the report, the lowest keycode in NKRO mode. KC_NO if none
+ * are pressed.
  */
 uint8_t get_first_key(report_keyboard_t* keyboard_report) {
 #ifdef NKRO_ENABLE
     if (keyboard_protocol && keymap_config.nkro) {
-        uint8_t i = 0;
-        for (; i < KEYBOARD_REPORT_BITS && !keyboard_report->nkro.bits[i]; i++)
-            ;
-        return i << 3 | biton(keyboard_report->nkro.bits[i]);
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_BITS; i += NKRO_WORD_SIZE) {
+            nkro_word_t word = nkro_word_at(keyboard_report, i);
+            if (word) {
+                return i << 3 | __builtin_ctz(word);
+            }
+        }
+        return KC_NO;
     }
 #endif
 #ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
@@ -213,7 +245,7 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
 #ifdef NKRO_ENABLE
 /** \brief add key bit
  *
- * FIXME: Needs doc
+ * Sets the bit for the key in the NKRO bitmap.
  */
 void add_key_bit(report_keyboard_t* keyboard_report, uint8_t code) {
     if ((code >> 3) < KEYBOARD_REPORT_BITS) {
@@ -225,7 +257,7 @@ void add_key_bit(report_keyboard_t* keyboard_report, uint8_t code) {
 
 /** \brief del key bit
  *
- * FIXME: Needs doc
+ * Clears the bit for the key in the NKRO bitmap.
  */
 void del_key_bit(report_keyboard_t* keyboard_report, uint8_t code) {
     if ((code >> 3) < KEYBOARD_REPORT_BITS) {
@@ -279,6 +311,28 @@ void clear_keys_from_report(report_keyboard_t* keyboard_report) {
     memset(keyboard_report->keys, 0, sizeof(keyboard_report->keys));
 }
 
+/**
+ * @brief Compares 2 keyboard reports for difference and returns result
+ *
+ * Only the mods and the keys of the active report format are compared, the
+ * report ID and NKRO mods are filled in by host_keyboard_send().
+ *
+ * @param[in] new_report report_keyboard_t
+ * @param[in] old_report report_keyboard_t
+ * @return bool result
+ */
+__attribute__((weak)) bool has_keyboard_report_changed(report_keyboard_t* new_report, report_keyboard_t* old_report) {
+    if (new_report->mods != old_report->mods) {
+        return true;
+    }
+#ifdef NKRO_ENABLE
+    if (keyboard_protocol && keymap_config.nkro) {
+        return memcmp(new_report->nkro.bits, old_report->nkro.bits, sizeof(new_report->nkro.bits)) != 0;
+    }
+#endif
+    return memcmp(new_report->keys, old_report->keys, sizeof(new_report->keys)) != 0;
+}
+
 #ifdef MOUSE_ENABLE
 /**
  * @brief Compares 2 mouse reports for difference and returns result
@@ -127,15 +127,19 @@ enum desktop_usages {
 #if defined(NKRO_ENABLE)
 #    if defined(PROTOCOL_LUFA) || defined(PROTOCOL_CHIBIOS)
 #        include "protocol/usb_descriptor.h"
-#        define KEYBOARD_REPORT_BITS (SHARED_EPSIZE - 2)
+#        define KEYBOARD_REPORT_BITS_MAX (SHARED_EPSIZE - 2)
 #    elif defined(PROTOCOL_ARM_ATSAM)
 #        include "protocol/arm_atsam/usb/udi_device_epsize.h"
-#        define KEYBOARD_REPORT_BITS (NKRO_EPSIZE - 1)
+#        define KEYBOARD_REPORT_BITS_MAX (NKRO_EPSIZE - 1)
 #        undef NKRO_SHARED_EP
 #        undef MOUSE_SHARED_EP
-#    else
+#    elif !defined(KEYBOARD_REPORT_BITS)
 #        error "NKRO not supported with this protocol"
 #    endif
+/* Number of bytes in the NKRO bitmap, can be lowered to shrink the report */
+#    ifndef KEYBOARD_REPORT_BITS
+#        define KEYBOARD_REPORT_BITS KEYBOARD_REPORT_BITS_MAX
+#    endif
 #endif
 
 #ifdef KEYBOARD_SHARED_EP
@@ -330,6 +334,8 @@ void add_key_to_report(report_keyboard_t* keyboard_report, uint8_t key);
 void del_key_from_report(report_keyboard_t* keyboard_report, uint8_t key);
 void clear_keys_from_report(report_keyboard_t* keyboard_report);
 
+bool has_keyboard_report_changed(report_keyboard_t* new_report, report_keyboard_t* old_report);
+
 #ifdef MOUSE_ENABLE
 bool has_mouse_report_changed(report_mouse_t* new_report, report_mouse_t* old_report);
 #endif
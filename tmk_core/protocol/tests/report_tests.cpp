@@ -0,0 +1,157 @@
+// Copyright 2022 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "report.h"
+#include "keycode.h"
+#include "keycode_config.h"
+
+uint8_t         keyboard_protocol = 1;
+keymap_config_t keymap_config;
+}
+
+#include <cstring>
+
+class Report : public testing::Test {
+   protected:
+    void SetUp() override {
+        keyboard_protocol  = 1;
+        keymap_config.raw  = 0;
+        keymap_config.nkro = true;
+        memset(&report, 0, sizeof(report));
+        memset(&other, 0, sizeof(other));
+        clear_keys_from_report(&report);
+    }
+
+    report_keyboard_t report;
+    report_keyboard_t other;
+};
+
+TEST_F(Report, AddAndDeleteKeys) {
+    EXPECT_EQ(has_anykey(&report), 0);
+
+    add_key_to_report(&report, KC_A);
+    add_key_to_report(&report, KC_B);
+    EXPECT_EQ(has_anykey(&report), 2);
+    EXPECT_TRUE(is_key_pressed(&report, KC_A));
+    EXPECT_TRUE(is_key_pressed(&report, KC_B));
+    EXPECT_FALSE(is_key_pressed(&report, KC_C));
+
+    del_key_from_report(&report, KC_A);
+    EXPECT_EQ(has_anykey(&report), 1);
+    EXPECT_FALSE(is_key_pressed(&report, KC_A));
+
+    del_key_from_report(&report, KC_B);
+    EXPECT_EQ(has_anykey(&report), 0);
+}
+
+TEST_F(Report, ClearKeys) {
+    add_key_to_report(&report, KC_A);
+    add_key_to_report(&report, KC_ENTER);
+    clear_keys_from_report(&report);
+    EXPECT_EQ(has_anykey(&report), 0);
+    EXPECT_FALSE(is_key_pressed(&report, KC_A));
+    EXPECT_FALSE(is_key_pressed(&report, KC_ENTER));
+}
+
+TEST_F(Report, IdenticalReportsAreUnchanged) {
+    add_key_to_report(&report, KC_A);
+    report.mods = MOD_BIT(KC_LEFT_SHIFT);
+    memcpy(&other, &report, sizeof(report));
+    EXPECT_FALSE(has_keyboard_report_changed(&report, &other));
+}
+
+TEST_F(Report, ModsChangeReport) {
+    memcpy(&other, &report, sizeof(report));
+    report.mods = MOD_BIT(KC_LEFT_CTRL);
+    EXPECT_TRUE(has_keyboard_report_changed(&report, &other));
+}
+
+TEST_F(Report, KeysChangeReport) {
+    memcpy(&other, &report, sizeof(report));
+    add_key_to_report(&report, KC_Z);
+    EXPECT_TRUE(has_keyboard_report_changed(&report, &other));
+}
+
+#ifdef NKRO_ENABLE
+TEST_F(Report, NkroCountsKeysOnce) {
+    add_key_to_report(&report, KC_A);
+    add_key_to_report(&report, KC_A);
+    EXPECT_EQ(has_anykey(&report), 1);
+
+    del_key_from_report(&report, KC_B);
+    EXPECT_EQ(has_anykey(&report), 1);
+
+    del_key_from_report(&report, KC_A);
+    del_key_from_report(&report, KC_A);
+    EXPECT_EQ(has_anykey(&report), 0);
+}
+
+TEST_F(Report, NkroCountsAllKeys) {
+    for (uint16_t code = 0; code < KEYBOARD_REPORT_BITS * 8; code++) {
+        add_key_bit(&report, code);
+    }
+    EXPECT_EQ(has_anykey(&report), KEYBOARD_REPORT_BITS * 8);
+    EXPECT_EQ(get_first_key(&report), 0);
+}
+
+TEST_F(Report, NkroIgnoresKeysOutsideBitmap) {
+    add_key_bit(&report, KEYBOARD_REPORT_BITS * 8);
+    EXPECT_EQ(has_anykey(&report), 0);
+    EXPECT_FALSE(is_key_pressed(&report, KEYBOARD_REPORT_BITS * 8));
+}
+
+TEST_F(Report, NkroFirstKeyIsLowest) {
+    EXPECT_EQ(get_first_key(&report), KC_NO);
+
+    add_key_to_report(&report, KC_Z);
+    add_key_to_report(&report, KC_B);
+    add_key_to_report(&report, KC_F);
+    EXPECT_EQ(get_first_key(&report), KC_B);
+    del_key_from_report(&report, KC_B);
+    EXPECT_EQ(get_first_key(&report), KC_F);
+}
+
+TEST_F(Report, NkroFirstKeyInEveryPosition) {
+    for (uint16_t code = 1; code < KEYBOARD_REPORT_BITS * 8; code++) {
+        add_key_bit(&report, code);
+        ASSERT_EQ(get_first_key(&report), code);
+        del_key_bit(&report, code);
+    }
+}
+
+TEST_F(Report, NkroReportIdDoesNotChangeReport) {
+    add_key_to_report(&report, KC_A);
+    memcpy(&other, &report, sizeof(report));
+    /* host_keyboard_send() fills these in after the comparison. */
+    report.nkro.report_id = REPORT_ID_NKRO;
+    report.nkro.mods      = MOD_BIT(KC_LEFT_SHIFT);
+    other.nkro.report_id  = 0;
+    other.nkro.mods       = 0;
+    report.mods           = other.mods;
+    EXPECT_FALSE(has_keyboard_report_changed(&report, &other));
+}
+
+TEST_F(Report, NkroCountIsPerReport) {
+    add_key_to_report(&report, KC_A);
+    add_key_to_report(&report, KC_B);
+    add_key_to_report(&other, KC_C);
+    EXPECT_EQ(has_anykey(&report), 2);
+    EXPECT_EQ(has_anykey(&other), 1);
+
+    clear_keys_from_report(&other);
+    EXPECT_EQ(has_anykey(&report), 2);
+
+    memcpy(&other, &report, sizeof(report));
+    EXPECT_EQ(has_anykey(&other), 2);
+}
+#else
+TEST_F(Report, FirstKey) {
+    EXPECT_EQ(get_first_key(&report), KC_NO);
+    add_key_to_report(&report, KC_Z);
+    add_key_to_report(&report, KC_B);
+    EXPECT_EQ(get_first_key(&report), KC_Z);
+}
+#endif
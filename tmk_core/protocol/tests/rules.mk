@@ -0,0 +1,24 @@
+report_common_DEFS := \
+	-DNO_PRINT \
+	-DNO_DEBUG
+report_common_SRC := \
+	$(TMK_PATH)/protocol/report.c \
+	$(TMK_PATH)/protocol/tests/report_tests.cpp
+report_common_INC := \
+	$(TMK_PATH)/protocol
+
+report_6kro_DEFS := \
+	$(report_common_DEFS)
+report_6kro_SRC := \
+	$(report_common_SRC)
+report_6kro_INC := \
+	$(report_common_INC)
+
+report_nkro_DEFS := \
+	$(report_common_DEFS) \
+	-DNKRO_ENABLE \
+	-DKEYBOARD_REPORT_BITS=30
+report_nkro_SRC := \
+	$(report_common_SRC)
+report_nkro_INC := \
+	$(report_common_INC)
@@ -0,0 +1,3 @@
+TEST_LIST += \
+	report_6kro \
+	report_nkro
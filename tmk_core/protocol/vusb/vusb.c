@@ -36,7 +36,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #endif
 
 #if defined(CONSOLE_ENABLE)
-#    define RBUF_SIZE 128
 #    include "ring_buffer.h"
 #endif
 
@@ -170,9 +169,14 @@ void raw_hid_task(void) {
 #ifdef CONSOLE_ENABLE
 #    define CONSOLE_BUFFER_SIZE 32
 #    define CONSOLE_EPSIZE 8
+#    define CONSOLE_RING_SIZE 128
+
+RING_BUFFER_DECLARE(console_ring, uint8_t, CONSOLE_RING_SIZE);
+
+static console_ring_t console_buffer;
 
 int8_t sendchar(uint8_t c) {
-    rbuf_enqueue(c);
+    console_ring_push(&console_buffer, c);
     return 0;
 }
 
@@ -194,15 +198,15 @@ void console_task(void) {
         return;
     }
 
-    if (!rbuf_has_data()) {
+    if (console_ring_empty(&console_buffer)) {
         return;
     }
 
     // Send in chunks of 8 padded to 32
     char    send_buf[CONSOLE_BUFFER_SIZE] = {0};
     uint8_t send_buf_count                = 0;
-    while (rbuf_has_data() && send_buf_count < CONSOLE_EPSIZE) {
-        send_buf[send_buf_count++] = rbuf_dequeue();
+    while (send_buf_count < CONSOLE_EPSIZE && console_ring_pop(&console_buffer, (uint8_t *)&send_buf[send_buf_count])) {
+        send_buf_count++;
     }
 
     char *temp = send_buf;